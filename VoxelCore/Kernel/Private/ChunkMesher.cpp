@@ -0,0 +1,18 @@
+#include "VoxelKernel/ChunkMesher.h"
+
+namespace VoxelKernel
+{
+    uint32_t GetSectionMaskForCellY(int32_t Y)
+    {
+        if (Y < 0 || Y >= CHUNK_SIZE_Y) return 0;
+
+        const int32_t Section = Y / CHUNK_SECTION_SIZE_Y;
+        uint32_t Mask = 1u << Section;
+
+        // Faces between two sections belong to whichever cell is solid, so both sides may change.
+        const int32_t InSection = Y - Section * CHUNK_SECTION_SIZE_Y;
+        if (InSection == 0 && Section > 0)                                             Mask |= 1u << (Section - 1);
+        if (InSection == CHUNK_SECTION_SIZE_Y - 1 && Section < CHUNK_NUM_SECTIONS - 1) Mask |= 1u << (Section + 1);
+        return Mask;
+    }
+}
@@ -0,0 +1,35 @@
+#include "VoxelKernel/ChunkStorage.h"
+
+namespace VoxelKernel
+{
+    void FChunkExtents::FoldColumns()
+    {
+        MinNonAirY = CHUNK_SIZE_Y;
+        MaxNonAirY = -1;
+        for (int32_t C = 0; C < CHUNK_COLUMNS; ++C)
+        {
+            if (ColumnMinY[C] > ColumnMaxY[C]) continue;
+            MinNonAirY = std::min(MinNonAirY, (int32_t)ColumnMinY[C]);
+            MaxNonAirY = std::max(MaxNonAirY, (int32_t)ColumnMaxY[C]);
+        }
+    }
+
+    void ComputeExtents(const uint8_t* Blocks, FChunkExtents& OutExtents)
+    {
+        OutExtents.Reset();
+
+        // Layer by layer, so the scan walks memory in order
+        for (int32_t Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+        {
+            const uint8_t* Layer = Blocks + Y * CHUNK_COLUMNS;
+            for (int32_t C = 0; C < CHUNK_COLUMNS; ++C)
+            {
+                if (Layer[C] == BlockId::Air) continue;
+                if (OutExtents.ColumnMinY[C] > Y) OutExtents.ColumnMinY[C] = (uint8_t)Y;
+                OutExtents.ColumnMaxY[C] = (uint8_t)Y;
+            }
+        }
+
+        OutExtents.FoldColumns();
+    }
+}
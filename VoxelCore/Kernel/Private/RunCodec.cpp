@@ -0,0 +1,116 @@
+#include "VoxelKernel/RunCodec.h"
+#include <algorithm>
+#include <cstring>
+
+namespace VoxelKernel
+{
+    namespace
+    {
+        struct FRun
+        {
+            int32_t Start = 0;
+            int32_t Num = 0;
+            uint8_t Id = 0;
+        };
+
+        // Runs over cells added in increasing index order, and the palette they index
+        struct FRunBuilder
+        {
+            std::vector<FRun> Runs;
+            std::vector<uint8_t> Palette;
+            uint8_t PaletteSlot[256];
+
+            FRunBuilder()
+            {
+                std::memset(PaletteSlot, 0xFF, sizeof(PaletteSlot));
+            }
+
+            void Add(int32_t Index, uint8_t Id)
+            {
+                if (PaletteSlot[Id] == 0xFF)
+                {
+                    PaletteSlot[Id] = (uint8_t)Palette.size();
+                    Palette.push_back(Id);
+                }
+
+                if (!Runs.empty() && Runs.back().Id == Id && Runs.back().Start + Runs.back().Num == Index)
+                {
+                    ++Runs.back().Num;
+                }
+                else
+                {
+                    Runs.push_back({ Index, 1, Id });
+                }
+            }
+
+            void Write(std::vector<uint8_t>& OutBody) const
+            {
+                FBitStreamWriter Writer;
+                const uint32_t NumPalette = (uint32_t)Palette.size();
+                Writer.WriteIntPacked(NumPalette);
+                for (uint8_t Id : Palette)
+                {
+                    Writer.WriteByte(Id);
+                }
+
+                Writer.WriteIntPacked((uint32_t)Runs.size());
+                int32_t PrevEnd = 0;
+                for (const FRun& Run : Runs)
+                {
+                    Writer.WriteIntPacked((uint32_t)(Run.Start - PrevEnd));
+                    Writer.WriteIntPacked((uint32_t)(Run.Num - 1));
+                    if (NumPalette > 1)
+                    {
+                        Writer.WriteInt(PaletteSlot[Run.Id], NumPalette);
+                    }
+                    PrevEnd = Run.Start + Run.Num;
+                }
+
+                OutBody.swap(Writer.GetBuffer());
+            }
+        };
+    }
+
+    void WriteCellRuns(FCellValue* Cells, int32_t NumCells, std::vector<uint8_t>& OutBody)
+    {
+        FCellValue* End = std::remove_if(Cells, Cells + NumCells, [](const FCellValue& Cell)
+            {
+                return Cell.Index < 0 || Cell.Index >= CHUNK_VOLUME;
+            });
+        std::stable_sort(Cells, End, [](const FCellValue& A, const FCellValue& B) { return A.Index < B.Index; });
+
+        FRunBuilder Builder;
+        for (FCellValue* Cell = Cells; Cell != End; ++Cell)
+        {
+            // Equal indices are adjacent and in submission order: keep the last
+            if (Cell + 1 != End && Cell[1].Index == Cell->Index) continue;
+            Builder.Add(Cell->Index, Cell->Id);
+        }
+        Builder.Write(OutBody);
+    }
+
+    void WriteBlockRuns(const uint8_t* Blocks, std::vector<uint8_t>& OutBody)
+    {
+        // Every cell, in index order: runs are the chunk's Y layers row by row, so air and stone layers fold into a few
+        FRunBuilder Builder;
+        Builder.Runs.reserve(1024);
+        for (int32_t Index = 0; Index < CHUNK_VOLUME; ++Index)
+        {
+            Builder.Add(Index, Blocks[Index]);
+        }
+        Builder.Write(OutBody);
+    }
+
+    bool ReadBlockRuns(const uint8_t* Data, size_t NumBytes, uint8_t* OutBlocks)
+    {
+        int32_t Covered = 0;
+        const bool bOk = ReadRuns(Data, NumBytes, [OutBlocks, &Covered](int32_t Start, int32_t End, uint8_t Id)
+            {
+                // Runs must tile the chunk with no gaps
+                if (Start != Covered) return;
+                std::memset(OutBlocks + Start, Id, End - Start);
+                Covered = End;
+            });
+        return bOk && Covered == CHUNK_VOLUME;
+    }
+}
@@ -0,0 +1,73 @@
+#include "VoxelKernel/TerrainGenerator.h"
+#include <cmath>
+
+namespace VoxelKernel
+{
+    FTerrainGenerator::FTerrainGenerator(int32_t InSeed)
+        : Seed(InSeed)
+        , HeightScale(static_cast<float>(CHUNK_SIZE_Y) * 0.6f) // ~60% of vertical range
+        , HeightOffset(static_cast<float>(CHUNK_SIZE_Y) * 0.2f) // base offset
+        , NoiseFrequency(0.05f)
+    {
+        NoiseHeight.SetSeed(Seed);
+        NoiseHeight.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
+        NoiseHeight.SetFrequency(NoiseFrequency);
+    }
+
+    int32_t FTerrainGenerator::HeightFromNoise(float NoiseValue) const
+    {
+        const float Norm = (NoiseValue + 1.0f) * 0.5f; // 0..1
+        const float H = Norm * HeightScale + HeightOffset;
+
+        // Round half up, then keep at least one solid cell and one air cell per column
+        const int32_t Height = static_cast<int32_t>(std::floor(H + 0.5f));
+        return std::clamp(Height, 1, CHUNK_SIZE_Y - 1);
+    }
+
+    int32_t FTerrainGenerator::SampleColumnTopY(int32_t WorldX, int32_t WorldZ) const
+    {
+        const float NX = static_cast<float>(WorldX) * NoiseFrequency;
+        const float NZ = static_cast<float>(WorldZ) * NoiseFrequency;
+        return HeightFromNoise(NoiseHeight.GetNoise(NX, NZ));
+    }
+
+    void FTerrainGenerator::SampleColumnTopYGrid(int32_t WorldX0, int32_t WorldZ0, int32_t Stride, int32_t NumX, int32_t NumZ, int32_t* OutTops) const
+    {
+        for (int32_t iz = 0; iz < NumZ; ++iz)
+        {
+            const float NZ = static_cast<float>(WorldZ0 + iz * Stride) * NoiseFrequency;
+            for (int32_t ix = 0; ix < NumX; ++ix)
+            {
+                const float NX = static_cast<float>(WorldX0 + ix * Stride) * NoiseFrequency;
+                OutTops[ix + iz * NumX] = HeightFromNoise(NoiseHeight.GetNoise(NX, NZ));
+            }
+        }
+    }
+
+    void FTerrainGenerator::GenerateBaseChunk(int32_t ChunkX, int32_t ChunkZ, uint8_t* OutBlocks, FChunkExtents& OutExtents) const
+    {
+        OutExtents.Reset();
+
+        for (int32_t LocalZ = 0; LocalZ < CHUNK_SIZE_Z; ++LocalZ)
+        {
+            for (int32_t LocalX = 0; LocalX < CHUNK_SIZE_X; ++LocalX)
+            {
+                const int32_t ColumnTopY = SampleColumnTopY(ChunkX * CHUNK_SIZE_X + LocalX, ChunkZ * CHUNK_SIZE_Z + LocalZ);
+
+                // Columns are solid from 0 up to ColumnTopY: extents come straight from the height
+                const int32_t C = ColumnIndex(LocalX, LocalZ);
+                OutExtents.ColumnMinY[C] = 0;
+                OutExtents.ColumnMaxY[C] = (uint8_t)ColumnTopY;
+                OutExtents.MinNonAirY = 0;
+                OutExtents.MaxNonAirY = std::max(OutExtents.MaxNonAirY, ColumnTopY);
+
+                // One column is every CHUNK_COLUMNS-th cell
+                uint8_t* Cell = OutBlocks + C;
+                for (int32_t LocalY = 0; LocalY < CHUNK_SIZE_Y; ++LocalY, Cell += CHUNK_COLUMNS)
+                {
+                    *Cell = GetBlockAtDepth(ColumnTopY - LocalY);
+                }
+            }
+        }
+    }
+}
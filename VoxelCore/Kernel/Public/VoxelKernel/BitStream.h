@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VoxelKernel
+{
+    // Bit writer with the engine's FBitWriter layout: bits fill each byte from the lowest. Packed and bounded ints are
+    // encoded like SerializeIntPacked / SerializeInt, so payloads match what FBitWriter would produce bit for bit.
+    class FBitStreamWriter
+    {
+    public:
+        // Low NumBits of Value, lowest first.
+        void WriteBits(uint32_t Value, int32_t NumBits)
+        {
+            while (NumBits > 0)
+            {
+                const int32_t BitInByte = static_cast<int32_t>(Pos & 7);
+                if (BitInByte == 0) Buffer.push_back(0);
+
+                const int32_t Take = (8 - BitInByte < NumBits) ? 8 - BitInByte : NumBits;
+                Buffer.back() |= static_cast<uint8_t>((Value & ((1u << Take) - 1u)) << BitInByte);
+                Value >>= Take;
+                NumBits -= Take;
+                Pos += Take;
+            }
+        }
+
+        void WriteByte(uint8_t Value) { WriteBits(Value, 8); }
+
+        // 7 bits per byte, lowest group first; bit 0 of each byte is set when another byte follows.
+        void WriteIntPacked(uint32_t Value)
+        {
+            do
+            {
+                const uint32_t Group = Value & 0x7Fu;
+                Value >>= 7;
+                WriteBits((Group << 1) | (Value != 0 ? 1u : 0u), 8);
+            } while (Value != 0);
+        }
+
+        // Value in [0, ValueMax), lowest bit first, stopping as soon as no higher bit could keep it below ValueMax.
+        void WriteInt(uint32_t Value, uint32_t ValueMax)
+        {
+            if (Value >= ValueMax) Value = ValueMax - 1;
+
+            uint32_t Written = 0;
+            for (uint32_t Mask = 1; Written + Mask < ValueMax && Mask; Mask <<= 1)
+            {
+                const bool bSet = (Value & Mask) != 0;
+                WriteBits(bSet ? 1u : 0u, 1);
+                if (bSet) Written += Mask;
+            }
+        }
+
+        const std::vector<uint8_t>& GetBuffer() const { return Buffer; }
+        std::vector<uint8_t>& GetBuffer() { return Buffer; }
+
+    private:
+        std::vector<uint8_t> Buffer;
+        uint64_t Pos = 0;
+    };
+
+    // Reads what FBitStreamWriter (or FBitWriter) wrote. Reading past the end sets the error flag and returns zeros.
+    class FBitStreamReader
+    {
+    public:
+        FBitStreamReader(const uint8_t* InData, size_t InNumBytes)
+            : Data(InData)
+            , NumBits(static_cast<uint64_t>(InNumBytes) * 8)
+        {
+        }
+
+        uint32_t ReadBits(int32_t Count)
+        {
+            if (bError || Pos + static_cast<uint64_t>(Count) > NumBits)
+            {
+                bError = true;
+                return 0;
+            }
+
+            uint32_t Value = 0;
+            int32_t Shift = 0;
+            while (Count > 0)
+            {
+                const int32_t BitInByte = static_cast<int32_t>(Pos & 7);
+                const int32_t Take = (8 - BitInByte < Count) ? 8 - BitInByte : Count;
+                const uint32_t Bits = (static_cast<uint32_t>(Data[Pos >> 3]) >> BitInByte) & ((1u << Take) - 1u);
+                Value |= Bits << Shift;
+                Shift += Take;
+                Count -= Take;
+                Pos += Take;
+            }
+            return Value;
+        }
+
+        uint8_t ReadByte() { return static_cast<uint8_t>(ReadBits(8)); }
+
+        uint32_t ReadIntPacked()
+        {
+            uint32_t Value = 0;
+            for (int32_t Group = 0, Shift = 0; Group < 5; ++Group, Shift += 7)
+            {
+                const uint32_t Byte = ReadBits(8);
+                Value |= (Byte >> 1) << Shift;
+                if (!(Byte & 1u)) break;
+            }
+            return Value;
+        }
+
+        uint32_t ReadInt(uint32_t ValueMax)
+        {
+            uint32_t Value = 0;
+            for (uint32_t Mask = 1; Value + Mask < ValueMax && Mask; Mask <<= 1)
+            {
+                if (ReadBits(1)) Value |= Mask;
+            }
+            return Value;
+        }
+
+        bool IsError() const { return bError; }
+
+    private:
+        const uint8_t* Data = nullptr;
+        uint64_t NumBits = 0;
+        uint64_t Pos = 0;
+        bool bError = false;
+    };
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+
+// Engine-independent voxel kernels: chunk layout and storage, terrain generation, face culling and the cell run codec.
+// Plain C++17 on raw buffers, no engine types. VoxelCore compiles these sources as part of the module and wraps them
+// (ChunkConfig.h, FVoxelChunkData, FVoxelGenerator, FVoxelMesher_Naive, VoxelDeltaCodec); VoxelKernel/CMakeLists.txt
+// builds them standalone for unit tests and microbenchmarks.
+namespace VoxelKernel
+{
+    // Chunk size config - change these constants project-wide if needed.
+    constexpr int32_t CHUNK_SIZE_X = 16;
+    constexpr int32_t CHUNK_SIZE_Y = 128; // vertical axis
+    constexpr int32_t CHUNK_SIZE_Z = 16;
+    constexpr int32_t CHUNK_VOLUME = CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SIZE_Z;
+
+    // Cells per horizontal layer; also the number of columns.
+    constexpr int32_t CHUNK_COLUMNS = CHUNK_SIZE_X * CHUNK_SIZE_Z;
+
+    // Vertical mesh sections: a chunk is meshed and uploaded as CHUNK_NUM_SECTIONS slabs of this many layers.
+    constexpr int32_t CHUNK_SECTION_SIZE_Y = 16;
+    constexpr int32_t CHUNK_NUM_SECTIONS = CHUNK_SIZE_Y / CHUNK_SECTION_SIZE_Y;
+    constexpr uint32_t CHUNK_ALL_SECTIONS = (1u << CHUNK_NUM_SECTIONS) - 1u;
+    static_assert(CHUNK_SIZE_Y % CHUNK_SECTION_SIZE_Y == 0, "Sections must tile the chunk height");
+    static_assert(CHUNK_NUM_SECTIONS <= 32, "Section masks are uint32");
+
+    // Section argument for "the whole chunk" (INDEX_NONE on the engine side).
+    constexpr int32_t WHOLE_CHUNK = -1;
+
+    // Block ids the kernels produce or test for (same values as EBlockId).
+    namespace BlockId
+    {
+        constexpr uint8_t Air = 0;
+        constexpr uint8_t Dirt = 1;
+        constexpr uint8_t Grass = 2;
+        constexpr uint8_t Stone = 3;
+    }
+
+    // Indexing convention:
+    // X in [0,CHUNK_SIZE_X), Y in [0,CHUNK_SIZE_Y) vertical, Z in [0,CHUNK_SIZE_Z)
+    // Index = X + Z * CHUNK_SIZE_X + Y * (CHUNK_SIZE_X * CHUNK_SIZE_Z)
+    inline int32_t IndexFromXYZ(int32_t X, int32_t Y, int32_t Z)
+    {
+        return X + Z * CHUNK_SIZE_X + Y * CHUNK_COLUMNS;
+    }
+
+    inline void XYZFromIndex(int32_t Index, int32_t& OutX, int32_t& OutY, int32_t& OutZ)
+    {
+        OutY = Index / CHUNK_COLUMNS;
+        const int32_t Rem = Index - OutY * CHUNK_COLUMNS;
+        OutZ = Rem / CHUNK_SIZE_X;
+        OutX = Rem - OutZ * CHUNK_SIZE_X;
+    }
+
+    // Column of (X, Z): the index of its cell in layer 0.
+    inline int32_t ColumnIndex(int32_t X, int32_t Z)
+    {
+        return X + Z * CHUNK_SIZE_X;
+    }
+}
@@ -0,0 +1,332 @@
+#pragma once
+
+#include "VoxelKernel/ChunkStorage.h"
+#include <vector>
+
+namespace VoxelKernel
+{
+    // Cube face in world axes (voxel Z is world Y, voxel Y is world Z). Order is the mesher's emit order.
+    enum class EFace : uint8_t
+    {
+        PosX = 0,
+        NegX = 1,
+        PosY = 2, // north
+        NegY = 3, // south
+        PosZ = 4, // top
+        NegZ = 5, // bottom
+    };
+
+    // Corners per face, as world-axis offsets (0/1) from the cell's min corner: B = bottom, T = top.
+    //   B00(0,0,0) B10(1,0,0) B11(1,1,0) B01(0,1,0)  T00(0,0,1) T10(1,0,1) T11(1,1,1) T01(0,1,1)
+    inline constexpr int32_t FaceCorners[6][4][3] =
+    {
+        { {1,0,0}, {1,1,0}, {1,1,1}, {1,0,1} }, // +X: B10, B11, T11, T10
+        { {0,1,0}, {0,0,0}, {0,0,1}, {0,1,1} }, // -X: B01, B00, T00, T01
+        { {1,1,0}, {0,1,0}, {0,1,1}, {1,1,1} }, // +Y: B11, B01, T01, T11
+        { {0,0,0}, {1,0,0}, {1,0,1}, {0,0,1} }, // -Y: B00, B10, T10, T00
+        { {0,0,1}, {1,0,1}, {1,1,1}, {0,1,1} }, // +Z: T00, T10, T11, T01
+        { {0,1,0}, {1,1,0}, {1,0,0}, {0,0,0} }, // -Z: B01, B11, B10, B00
+    };
+
+    /**
+     * Compact 8-byte chunk vertex (vs. ~150 bytes for an FProcMeshVertex).
+     * Word0: corner X [0..16] 5 bits | corner Z [0..16] 5 bits | corner Y [0..128] 8 bits | face 3 bits | quad corner 2 bits
+     * Word1: atlas tile 8 bits | color index 8 bits (block id)
+     * Corners are in voxel units relative to the chunk; every 4 vertices form one quad.
+     */
+    struct FPackedVertex
+    {
+        uint32_t PosFace = 0;
+        uint32_t TileColor = 0;
+
+        static FPackedVertex Pack(int32_t X, int32_t Y, int32_t Z, EFace Face, int32_t Corner, uint8_t Tile, uint8_t ColorIndex)
+        {
+            FPackedVertex V;
+            V.PosFace = (uint32_t(X) & 0x1F)
+                | ((uint32_t(Z) & 0x1F) << 5)
+                | ((uint32_t(Y) & 0xFF) << 10)
+                | ((uint32_t(Face) & 0x7) << 18)
+                | ((uint32_t(Corner) & 0x3) << 21);
+            V.TileColor = uint32_t(Tile) | (uint32_t(ColorIndex) << 8);
+            return V;
+        }
+
+        int32_t GetX() const { return PosFace & 0x1F; }
+        int32_t GetZ() const { return (PosFace >> 5) & 0x1F; }
+        int32_t GetY() const { return (PosFace >> 10) & 0xFF; }
+        EFace GetFace() const { return static_cast<EFace>((PosFace >> 18) & 0x7); }
+        int32_t GetCorner() const { return (PosFace >> 21) & 0x3; }
+        uint8_t GetTile() const { return static_cast<uint8_t>(TileColor & 0xFF); }
+        uint8_t GetColorIndex() const { return static_cast<uint8_t>((TileColor >> 8) & 0xFF); }
+    };
+    static_assert(sizeof(FPackedVertex) == 8, "FPackedVertex must stay 8 bytes");
+    static_assert(CHUNK_SIZE_X <= 16 && CHUNK_SIZE_Z <= 16 && CHUNK_SIZE_Y <= 128, "Packed corner bits assume 16x128x16 chunks");
+
+    // Far-chunk LODs: level L downsamples columns by (1 << L), i.e. 2x / 4x / 8x.
+    constexpr int32_t MAX_LOD = 3;
+    static_assert((CHUNK_SIZE_X % (1 << MAX_LOD)) == 0 && (CHUNK_SIZE_Z % (1 << MAX_LOD)) == 0, "LOD steps must tile the chunk");
+
+    // Neighbor layers touching a chunk's four vertical sides (see FVoxelChunkBorders).
+    struct FBorderView
+    {
+        // Sides in chunk-key space (chunk Z is world Y).
+        enum ESide : int32_t { PosX = 0, NegX = 1, PosZ = 2, NegZ = 3, NumSides = 4 };
+
+        // Per side: ids of the touching neighbor layer, Along + Y * AlongSize (along = Z for X sides, X for Z sides),
+        // or null when the neighbor was not available.
+        const uint8_t* Slabs[NumSides] = {};
+
+        // Assumption for sides without a slab: false = air (emit border faces), true = solid (cull them).
+        bool bMissingIsSolid = false;
+
+        static int32_t AlongSize(int32_t Side) { return Side < PosZ ? CHUNK_SIZE_Z : CHUNK_SIZE_X; }
+
+        // True if the cell just across Side (at Along, Y) is air, or assumed air.
+        bool IsAirAcross(int32_t Side, int32_t Along, int32_t Y) const
+        {
+            if (!Slabs[Side]) return !bMissingIsSolid;
+            return Slabs[Side][Along + Y * AlongSize(Side)] == BlockId::Air;
+        }
+    };
+
+    // Sections touched by an edit at local Y: its own, plus the one across when Y sits on a section boundary.
+    uint32_t GetSectionMaskForCellY(int32_t Y);
+
+    // Culling walk: calls EmitCellFace(X, Y, Z, Face, Id) for every solid cell face that borders air.
+    // Borders = optional neighbor layers; without them every side of the chunk counts as air.
+    // SectionIndex = vertical section to walk, or WHOLE_CHUNK; faces across its top/bottom still test the real cells.
+    template<typename CellFaceFunc>
+    void ForEachVisibleCellFace(const FChunkView& Chunk, const FBorderView* Borders, int32_t SectionIndex, CellFaceFunc&& EmitCellFace)
+    {
+        const FChunkExtents& Extents = *Chunk.Extents;
+        if (Extents.IsEmpty()) return;
+
+        const int32_t SectionMinY = (SectionIndex == WHOLE_CHUNK) ? 0 : SectionIndex * CHUNK_SECTION_SIZE_Y;
+        const int32_t SectionMaxY = (SectionIndex == WHOLE_CHUNK) ? CHUNK_SIZE_Y - 1 : SectionMinY + CHUNK_SECTION_SIZE_Y - 1;
+        if (SectionMinY > Extents.MaxNonAirY || SectionMaxY < Extents.MinNonAirY) return;
+
+        const uint8_t* Blocks = Chunk.Blocks;
+        auto IsAirAcross = [Borders](int32_t Side, int32_t Along, int32_t Y)
+            {
+                return Borders ? Borders->IsAirAcross(Side, Along, Y) : true;
+            };
+
+        for (int32_t X = 0; X < CHUNK_SIZE_X; ++X)
+        {
+            for (int32_t Z = 0; Z < CHUNK_SIZE_Z; ++Z)
+            {
+                // Only the column's non-air band can emit faces
+                const int32_t Col = ColumnIndex(X, Z);
+                const int32_t MinY = std::max((int32_t)Extents.ColumnMinY[Col], SectionMinY);
+                const int32_t MaxY = std::min((int32_t)Extents.ColumnMaxY[Col], SectionMaxY);
+                for (int32_t Y = MinY; Y <= MaxY; ++Y)
+                {
+                    const int32_t Index = Col + Y * CHUNK_COLUMNS;
+                    const uint8_t Id = Blocks[Index];
+                    if (Id == BlockId::Air) continue;
+
+                    // Neighbors inside the chunk are fixed index offsets; across a vertical side ask the border slabs
+                    const bool bAirPosX = (X + 1 < CHUNK_SIZE_X) ? Blocks[Index + 1] == BlockId::Air : IsAirAcross(FBorderView::PosX, Z, Y);
+                    const bool bAirNegX = (X > 0) ? Blocks[Index - 1] == BlockId::Air : IsAirAcross(FBorderView::NegX, Z, Y);
+                    const bool bAirPosZ = (Z + 1 < CHUNK_SIZE_Z) ? Blocks[Index + CHUNK_SIZE_X] == BlockId::Air : IsAirAcross(FBorderView::PosZ, X, Y);
+                    const bool bAirNegZ = (Z > 0) ? Blocks[Index - CHUNK_SIZE_X] == BlockId::Air : IsAirAcross(FBorderView::NegZ, X, Y);
+                    const bool bAirPosY = (Y + 1 >= CHUNK_SIZE_Y) || Blocks[Index + CHUNK_COLUMNS] == BlockId::Air;
+                    const bool bAirNegY = (Y == 0) || Blocks[Index - CHUNK_COLUMNS] == BlockId::Air;
+
+                    if (bAirPosX) EmitCellFace(X, Y, Z, EFace::PosX, Id);
+                    if (bAirNegX) EmitCellFace(X, Y, Z, EFace::NegX, Id);
+                    if (bAirPosZ) EmitCellFace(X, Y, Z, EFace::PosY, Id); // north
+                    if (bAirNegZ) EmitCellFace(X, Y, Z, EFace::NegY, Id); // south
+                    if (bAirPosY) EmitCellFace(X, Y, Z, EFace::PosZ, Id); // top
+                    if (bAirNegY) EmitCellFace(X, Y, Z, EFace::NegZ, Id); // bottom
+                }
+            }
+        }
+    }
+
+    // Collision walk: the same visible faces, greedy-merged into rectangles per face direction and layer regardless of
+    // block type. Calls EmitRect(Face, Lo, Hi) with the merged cell range in voxel units (X, Y vertical, Z), Hi exclusive.
+    template<typename RectFunc>
+    void ForEachCollisionRect(const FChunkView& Chunk, const FBorderView* Borders, int32_t SectionIndex, RectFunc&& EmitRect)
+    {
+        const int32_t MinY = (SectionIndex == WHOLE_CHUNK) ? 0 : SectionIndex * CHUNK_SECTION_SIZE_Y;
+        const int32_t NumY = (SectionIndex == WHOLE_CHUNK) ? CHUNK_SIZE_Y : CHUNK_SECTION_SIZE_Y;
+
+        // Visible faces per direction, one flag per cell (X + Z * SizeX + (Y - MinY) * SizeX * SizeZ, like the chunk)
+        const int32_t NumCells = CHUNK_COLUMNS * NumY;
+        std::vector<uint8_t> Visible(static_cast<size_t>(NumCells) * 6, 0);
+
+        bool bAnyFace = false;
+        ForEachVisibleCellFace(Chunk, Borders, SectionIndex, [&](int32_t X, int32_t Y, int32_t Z, EFace Face, uint8_t)
+            {
+                Visible[static_cast<int32_t>(Face) * NumCells + X + Z * CHUNK_SIZE_X + (Y - MinY) * CHUNK_COLUMNS] = 1;
+                bAnyFace = true;
+            });
+        if (!bAnyFace) return;
+
+        const int32_t Size[3] = { CHUNK_SIZE_X, NumY, CHUNK_SIZE_Z }; // voxel X, Y, Z
+
+        for (int32_t F = 0; F < 6; ++F)
+        {
+            // Voxel axis along the face normal (W) and the two in-plane axes (U, V).
+            const int32_t W = (F < 2) ? 0 : ((F < 4) ? 2 : 1);
+            const int32_t U = (W == 0) ? 2 : 0;
+            const int32_t V = (W == 1) ? 2 : 1;
+
+            uint8_t* Flags = &Visible[static_cast<size_t>(F) * NumCells];
+            auto CellIndex = [U, V, W](int32_t u, int32_t v, int32_t w)
+                {
+                    int32_t C[3];
+                    C[U] = u; C[V] = v; C[W] = w;
+                    return C[0] + C[2] * CHUNK_SIZE_X + C[1] * CHUNK_COLUMNS;
+                };
+
+            for (int32_t w = 0; w < Size[W]; ++w)
+            {
+                for (int32_t v = 0; v < Size[V]; ++v)
+                {
+                    for (int32_t u = 0; u < Size[U]; ++u)
+                    {
+                        if (!Flags[CellIndex(u, v, w)]) continue;
+
+                        // Greedy: widest run along U, then as many full rows along V as possible
+                        int32_t Width = 1;
+                        while (u + Width < Size[U] && Flags[CellIndex(u + Width, v, w)]) ++Width;
+
+                        int32_t Height = 1;
+                        for (; v + Height < Size[V]; ++Height)
+                        {
+                            bool bFullRow = true;
+                            for (int32_t du = 0; du < Width && bFullRow; ++du)
+                            {
+                                bFullRow = Flags[CellIndex(u + du, v + Height, w)] != 0;
+                            }
+                            if (!bFullRow) break;
+                        }
+
+                        for (int32_t dv = 0; dv < Height; ++dv)
+                        {
+                            for (int32_t du = 0; du < Width; ++du)
+                            {
+                                Flags[CellIndex(u + du, v + dv, w)] = 0;
+                            }
+                        }
+
+                        int32_t Lo[3], Hi[3];
+                        Lo[U] = u; Hi[U] = u + Width;
+                        Lo[V] = v; Hi[V] = v + Height;
+                        Lo[W] = w; Hi[W] = w + 1;
+                        Lo[1] += MinY; Hi[1] += MinY;
+                        EmitRect(static_cast<EFace>(F), Lo, Hi);
+                    }
+                }
+            }
+        }
+    }
+
+    // LOD walk at 1..MAX_LOD: each (1 << LOD)^2 block of columns becomes one column at its highest non-air cell, with
+    // side quads between columns and short skirts on the chunk edges that hide cracks against neighbors meshed at
+    // another level. Calls EmitQuad(Corners, Face, Id), corners in voxel units (X, Y vertical, Z) in FaceCorners order.
+    template<typename QuadFunc>
+    void ForEachLODQuad(const FChunkView& Chunk, int32_t LOD, QuadFunc&& EmitQuad)
+    {
+        const FChunkExtents& Extents = *Chunk.Extents;
+        if (Extents.IsEmpty()) return;
+
+        const int32_t Step = 1 << std::clamp(LOD, 1, MAX_LOD);
+        const int32_t NumCX = CHUNK_SIZE_X / Step;
+        const int32_t NumCZ = CHUNK_SIZE_Z / Step;
+
+        // Skirt depth on chunk edges: covers the height error of the coarsest neighbor we expect next to us.
+        const int32_t SkirtDepth = Step * 2;
+
+        // Coarse columns: top = highest column top in the block (top-surface sampling), id = the block found there.
+        constexpr int32_t MaxCoarseColumns = (CHUNK_SIZE_X / 2) * (CHUNK_SIZE_Z / 2);
+        int32_t Tops[MaxCoarseColumns];
+        uint8_t Ids[MaxCoarseColumns];
+        std::fill_n(Tops, NumCX * NumCZ, -1);
+        std::fill_n(Ids, NumCX * NumCZ, BlockId::Air);
+
+        for (int32_t CZ = 0; CZ < NumCZ; ++CZ)
+        {
+            for (int32_t CX = 0; CX < NumCX; ++CX)
+            {
+                int32_t& Top = Tops[CX + CZ * NumCX];
+                for (int32_t SZ = 0; SZ < Step; ++SZ)
+                {
+                    for (int32_t SX = 0; SX < Step; ++SX)
+                    {
+                        const int32_t X = CX * Step + SX;
+                        const int32_t Z = CZ * Step + SZ;
+                        const int32_t T = Extents.GetColumnTopY(ColumnIndex(X, Z));
+                        if (T > Top)
+                        {
+                            Top = T;
+                            Ids[CX + CZ * NumCX] = Chunk.GetBlock(X, T, Z);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Box face -> corners: Min/Size in voxel units (X, Y vertical, Z); FaceCorners offsets are world-axis order.
+        auto EmitBoxFace = [&EmitQuad](const int32_t (&Min)[3], const int32_t (&Size)[3], EFace Face, uint8_t Id)
+            {
+                const int32_t F = static_cast<int32_t>(Face);
+                int32_t Corners[4][3];
+                for (int32_t c = 0; c < 4; ++c)
+                {
+                    Corners[c][0] = Min[0] + FaceCorners[F][c][0] * Size[0];
+                    Corners[c][1] = Min[1] + FaceCorners[F][c][2] * Size[1];
+                    Corners[c][2] = Min[2] + FaceCorners[F][c][1] * Size[2];
+                }
+                EmitQuad(Corners, Face, Id);
+            };
+
+        // Side neighbors in coarse space, matching EFace PosX, NegX, PosY (north = +Z), NegY.
+        static constexpr int32_t SideDX[4] = { 1, -1, 0, 0 };
+        static constexpr int32_t SideDZ[4] = { 0, 0, 1, -1 };
+
+        for (int32_t CZ = 0; CZ < NumCZ; ++CZ)
+        {
+            for (int32_t CX = 0; CX < NumCX; ++CX)
+            {
+                const int32_t Top = Tops[CX + CZ * NumCX];
+                if (Top < 0) continue;
+
+                const uint8_t Id = Ids[CX + CZ * NumCX];
+                const int32_t X0 = CX * Step;
+                const int32_t Z0 = CZ * Step;
+
+                // Top face of the coarse column
+                const int32_t ColumnMin[3] = { X0, 0, Z0 };
+                const int32_t ColumnSize[3] = { Step, Top + 1, Step };
+                EmitBoxFace(ColumnMin, ColumnSize, EFace::PosZ, Id);
+
+                for (int32_t S = 0; S < 4; ++S)
+                {
+                    const int32_t NX = CX + SideDX[S];
+                    const int32_t NZ = CZ + SideDZ[S];
+
+                    int32_t Bottom = 0;
+                    if (NX >= 0 && NX < NumCX && NZ >= 0 && NZ < NumCZ)
+                    {
+                        // Inside the chunk: only the step down to a lower neighbor column is visible
+                        const int32_t NTop = Tops[NX + NZ * NumCX];
+                        if (NTop >= Top) continue;
+                        Bottom = NTop + 1;
+                    }
+                    else
+                    {
+                        // Chunk edge: skirt
+                        Bottom = std::max(0, Top + 1 - SkirtDepth);
+                    }
+
+                    const int32_t SideMin[3] = { X0, Bottom, Z0 };
+                    const int32_t SideSize[3] = { Step, Top + 1 - Bottom, Step };
+                    EmitBoxFace(SideMin, SideSize, static_cast<EFace>(S), Id);
+                }
+            }
+        }
+    }
+}
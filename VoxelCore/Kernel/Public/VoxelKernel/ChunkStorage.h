@@ -0,0 +1,86 @@
+#pragma once
+
+#include "VoxelKernel/ChunkLayout.h"
+#include <algorithm>
+#include <cstring>
+
+namespace VoxelKernel
+{
+    // Vertical extents of non-air cells, per column (ColumnIndex) and for the whole chunk; an empty range has Min > Max.
+    struct FChunkExtents
+    {
+        static_assert(CHUNK_SIZE_Y <= 255, "Column extents are stored as uint8");
+
+        uint8_t ColumnMinY[CHUNK_COLUMNS];
+        uint8_t ColumnMaxY[CHUNK_COLUMNS];
+        int32_t MinNonAirY = CHUNK_SIZE_Y;
+        int32_t MaxNonAirY = -1;
+
+        FChunkExtents()
+        {
+            Reset();
+        }
+
+        void Reset()
+        {
+            std::memset(ColumnMinY, CHUNK_SIZE_Y, sizeof(ColumnMinY));
+            std::memset(ColumnMaxY, 0, sizeof(ColumnMaxY));
+            MinNonAirY = CHUNK_SIZE_Y;
+            MaxNonAirY = -1;
+        }
+
+        bool IsEmpty() const { return MinNonAirY > MaxNonAirY; }
+        bool IsColumnEmpty(int32_t Column) const { return ColumnMinY[Column] > ColumnMaxY[Column]; }
+
+        // Highest non-air Y in the column, or -1 if the column is all air.
+        int32_t GetColumnTopY(int32_t Column) const
+        {
+            return IsColumnEmpty(Column) ? -1 : ColumnMaxY[Column];
+        }
+
+        // The cell at (X, Y, Z) became solid: O(1).
+        void Grow(int32_t X, int32_t Y, int32_t Z)
+        {
+            const int32_t C = ColumnIndex(X, Z);
+            const bool bWasEmpty = IsColumnEmpty(C);
+            if (bWasEmpty || ColumnMinY[C] > Y) ColumnMinY[C] = (uint8_t)Y;
+            if (bWasEmpty || ColumnMaxY[C] < Y) ColumnMaxY[C] = (uint8_t)Y;
+            MinNonAirY = std::min(MinNonAirY, Y);
+            MaxNonAirY = std::max(MaxNonAirY, Y);
+        }
+
+        // Re-scan one column; IsSolid(Y) tells whether its cell at height Y is non-air. Call FoldColumns afterwards.
+        template<typename IsSolidFunc>
+        void RescanColumn(int32_t X, int32_t Z, IsSolidFunc&& IsSolid)
+        {
+            const int32_t C = ColumnIndex(X, Z);
+            ColumnMinY[C] = (uint8_t)CHUNK_SIZE_Y;
+            ColumnMaxY[C] = 0;
+            for (int32_t Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+            {
+                if (!IsSolid(Y)) continue;
+                if (ColumnMinY[C] > Y) ColumnMinY[C] = (uint8_t)Y;
+                ColumnMaxY[C] = (uint8_t)Y;
+            }
+        }
+
+        // Chunk range from the column ranges.
+        void FoldColumns();
+    };
+
+    // Full rebuild from a dense block array (CHUNK_VOLUME ids).
+    void ComputeExtents(const uint8_t* Blocks, FChunkExtents& OutExtents);
+
+    // Read-only dense chunk for the kernels: effective ids (deltas already applied) and their extents.
+    // Kernels never own or resize chunk memory; Blocks may be null only when the extents are empty.
+    struct FChunkView
+    {
+        const uint8_t* Blocks = nullptr;
+        const FChunkExtents* Extents = nullptr;
+
+        uint8_t GetBlock(int32_t X, int32_t Y, int32_t Z) const
+        {
+            return Blocks[IndexFromXYZ(X, Y, Z)];
+        }
+    };
+}
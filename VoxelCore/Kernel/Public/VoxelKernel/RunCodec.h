@@ -0,0 +1,63 @@
+#pragma once
+
+#include "VoxelKernel/BitStream.h"
+#include "VoxelKernel/ChunkLayout.h"
+
+// Run body of the chunk cell wire format (VoxelDeltaCodec adds the flag byte and compression on the engine side).
+// Cells are sorted by index and grouped into runs of consecutive indices with the same id. The body is the palette
+// (varint count, one byte per id), then the runs (varint count): each the gap from the previous run (varint), its
+// length - 1 (varint) and a palette slot (just enough bits for the palette; none for a single-entry palette).
+namespace VoxelKernel
+{
+    struct FCellValue
+    {
+        int32_t Index = 0;
+        uint8_t Id = 0;
+    };
+
+    // Cells in any order: sorted in place (stable), the last value per index wins, indices outside the chunk are dropped.
+    void WriteCellRuns(FCellValue* Cells, int32_t NumCells, std::vector<uint8_t>& OutBody);
+
+    // Every cell of a chunk (CHUNK_VOLUME ids): one run per stretch of equal ids, so layered terrain costs a few
+    // hundred runs.
+    void WriteBlockRuns(const uint8_t* Blocks, std::vector<uint8_t>& OutBody);
+
+    // Calls Emit(Start, End, Id) for each run, End exclusive; false on a malformed body.
+    template<typename EmitFunc>
+    bool ReadRuns(const uint8_t* Data, size_t NumBytes, EmitFunc&& Emit)
+    {
+        FBitStreamReader Reader(Data, NumBytes);
+
+        const uint32_t NumPalette = Reader.ReadIntPacked();
+        if (Reader.IsError() || NumPalette > 256) return false;
+
+        uint8_t Palette[256];
+        for (uint32_t i = 0; i < NumPalette; ++i)
+        {
+            Palette[i] = Reader.ReadByte();
+        }
+
+        const uint32_t NumRuns = Reader.ReadIntPacked();
+        if (Reader.IsError() || NumRuns > (uint32_t)CHUNK_VOLUME || (NumRuns > 0 && NumPalette == 0)) return false;
+
+        int64_t Next = 0;
+        for (uint32_t r = 0; r < NumRuns; ++r)
+        {
+            const uint32_t Gap = Reader.ReadIntPacked();
+            const uint32_t Extra = Reader.ReadIntPacked();
+            const uint32_t Slot = (NumPalette > 1) ? Reader.ReadInt(NumPalette) : 0;
+            if (Reader.IsError() || Slot >= NumPalette) return false;
+
+            const int64_t Start = Next + Gap;
+            const int64_t End = Start + Extra + 1;
+            if (End > CHUNK_VOLUME) return false;
+
+            Emit((int32_t)Start, (int32_t)End, Palette[Slot]);
+            Next = End;
+        }
+        return !Reader.IsError();
+    }
+
+    // Whole-chunk body into OutBlocks (CHUNK_VOLUME ids); false unless the runs tile every cell of the chunk.
+    bool ReadBlockRuns(const uint8_t* Data, size_t NumBytes, uint8_t* OutBlocks);
+}
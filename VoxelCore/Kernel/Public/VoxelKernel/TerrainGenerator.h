@@ -0,0 +1,50 @@
+#pragma once
+
+#include "VoxelKernel/ChunkStorage.h"
+#include "FastNoiseLite.h"
+
+namespace VoxelKernel
+{
+    /**
+     * Deterministic heightmap terrain from FastNoiseLite (OpenSimplex2).
+     * - Stone deep, a few layers of dirt, grass on top, air above.
+     * - The same seed and chunk coordinates always produce the same blocks.
+     * - Const methods only read the noise state, so one generator can serve several threads.
+     */
+    class FTerrainGenerator
+    {
+    public:
+        explicit FTerrainGenerator(int32_t InSeed);
+
+        // Base chunk contents (no deltas): CHUNK_VOLUME ids into OutBlocks, and their extents.
+        void GenerateBaseChunk(int32_t ChunkX, int32_t ChunkZ, uint8_t* OutBlocks, FChunkExtents& OutExtents) const;
+
+        int32_t SampleColumnTopY(int32_t WorldX, int32_t WorldZ) const;
+
+        // Layering below a column top: Depth = ColumnTopY - Y (0 = the top cell, negative = air above).
+        static uint8_t GetBlockAtDepth(int32_t Depth)
+        {
+            if (Depth < 0)  return BlockId::Air;
+            if (Depth == 0) return BlockId::Grass;
+            if (Depth <= 3) return BlockId::Dirt;
+            return BlockId::Stone;
+        }
+
+        // NumX * NumZ column tops starting at (WorldX0, WorldZ0), every Stride columns; row-major (X fastest).
+        void SampleColumnTopYGrid(int32_t WorldX0, int32_t WorldZ0, int32_t Stride, int32_t NumX, int32_t NumZ, int32_t* OutTops) const;
+
+        void SetHeightScale(float InScale) { HeightScale = InScale; }
+        void SetHeightOffset(float InOffset) { HeightOffset = InOffset; }
+        void SetNoiseFrequency(float InFreq) { NoiseFrequency = InFreq; }
+
+    private:
+        int32_t Seed;
+        FastNoiseLite NoiseHeight;
+        float HeightScale;    // multiplier to convert noise to height
+        float HeightOffset;   // additive offset
+        float NoiseFrequency; // frequency scale for noise inputs
+
+        // Noise in [-1,1] to a column top in [1, CHUNK_SIZE_Y-1]
+        int32_t HeightFromNoise(float NoiseValue) const;
+    };
+}
@@ -0,0 +1,181 @@
+#include "VoxelCharacterMovementComponent.h"
+#include "VoxelWorldManager.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PhysicsVolume.h"
+#include "Components/CapsuleComponent.h"
+#include "VoxelWorldSubsystem.h"
+
+void UVoxelCharacterMovementComponent::SetMovementMode(EMovementMode NewMovementMode, uint8 NewCustomMode)
+{
+    // Ground and air movement both run on the voxel grid; everything else (flying, swimming, none) is stock
+    if (bUseVoxelCollision)
+    {
+        if (NewMovementMode == MOVE_Walking || NewMovementMode == MOVE_NavWalking)
+        {
+            Super::SetMovementMode(MOVE_Custom, VOXEL_MOVE_Walking);
+            return;
+        }
+        if (NewMovementMode == MOVE_Falling)
+        {
+            Super::SetMovementMode(MOVE_Custom, VOXEL_MOVE_Falling);
+            return;
+        }
+    }
+    Super::SetMovementMode(NewMovementMode, NewCustomMode);
+}
+
+bool UVoxelCharacterMovementComponent::IsMovingOnGround() const
+{
+    return Super::IsMovingOnGround() || (MovementMode == MOVE_Custom && CustomMovementMode == VOXEL_MOVE_Walking && UpdatedComponent);
+}
+
+bool UVoxelCharacterMovementComponent::IsFalling() const
+{
+    return Super::IsFalling() || (MovementMode == MOVE_Custom && CustomMovementMode == VOXEL_MOVE_Falling && UpdatedComponent);
+}
+
+float UVoxelCharacterMovementComponent::GetMaxSpeed() const
+{
+    // MOVE_Custom would use MaxCustomMovementSpeed; the voxel modes are walking/falling
+    if (IsInVoxelMode())
+    {
+        return IsCrouching() ? MaxWalkSpeedCrouched : MaxWalkSpeed;
+    }
+    return Super::GetMaxSpeed();
+}
+
+float UVoxelCharacterMovementComponent::GetMaxBrakingDeceleration() const
+{
+    if (IsInVoxelMode())
+    {
+        return (CustomMovementMode == VOXEL_MOVE_Walking) ? BrakingDecelerationWalking : BrakingDecelerationFalling;
+    }
+    return Super::GetMaxBrakingDeceleration();
+}
+
+AVoxelWorldManager* UVoxelCharacterMovementComponent::GetVoxelWorld()
+{
+    if (AVoxelWorldManager* Cached = VoxelWorld.Get())
+    {
+        return Cached;
+    }
+
+    const UVoxelWorldSubsystem* Registry = UVoxelWorldSubsystem::Get(GetWorld());
+    if (!Registry) return nullptr;
+
+    // Server/standalone moves against the authoritative data, clients against their visual copy
+    const bool bServer = GetOwner() && GetOwner()->HasAuthority();
+    AVoxelWorldManager* Found = bServer ? Registry->GetAuthoritativeManager() : Registry->GetClientVisualManager();
+    if (!Found) Found = Registry->GetLocalManager();
+
+    VoxelWorld = Found;
+    return Found;
+}
+
+FVector UVoxelCharacterMovementComponent::GetVoxelExtent() const
+{
+    if (CharacterOwner && CharacterOwner->GetCapsuleComponent())
+    {
+        float Radius = 0.f, HalfHeight = 0.f;
+        CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(Radius, HalfHeight);
+        return FVector(Radius, Radius, HalfHeight);
+    }
+    return UpdatedComponent ? UpdatedComponent->Bounds.BoxExtent : FVector::ZeroVector;
+}
+
+void UVoxelCharacterMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+    if (!IsInVoxelMode())
+    {
+        Super::PhysCustom(DeltaTime, Iterations);
+        return;
+    }
+    if (DeltaTime < MIN_TICK_TIME) return;
+
+    // No voxel data yet (client still streaming): hold position
+    AVoxelWorldManager* World = GetVoxelWorld();
+    if (!World) return;
+
+    PhysVoxel(DeltaTime, *World);
+}
+
+void UVoxelCharacterMovementComponent::PhysVoxel(float DeltaTime, AVoxelWorldManager& World)
+{
+    const bool bWasOnGround = (CustomMovementMode == VOXEL_MOVE_Walking);
+
+    // Lateral velocity like PhysWalking (friction/braking) or PhysFalling (air control)
+    if (!HasAnimRootMotion() && !CurrentRootMotion.HasOverrideVelocity())
+    {
+        const FVector::FReal VelZ = Velocity.Z;
+        Velocity.Z = 0.f;
+        if (bWasOnGround)
+        {
+            CalcVelocity(DeltaTime, GroundFriction, false, GetMaxBrakingDeceleration());
+        }
+        else
+        {
+            const FVector InputAccel = Acceleration;
+            Acceleration = GetFallingLateralAcceleration(DeltaTime);
+            CalcVelocity(DeltaTime, FallingLateralFriction, false, GetMaxBrakingDeceleration());
+            Acceleration = InputAccel;
+        }
+        Velocity.Z = VelZ;
+    }
+    ApplyRootMotionToVelocity(DeltaTime);
+
+    Velocity.Z += GetGravityZ() * DeltaTime;
+    Velocity.Z = FMath::Max<FVector::FReal>(Velocity.Z, -GetPhysicsVolume()->TerminalVelocity);
+
+    const FVector Extent = GetVoxelExtent();
+    const FVector Start = UpdatedComponent->GetComponentLocation();
+    const FVector Delta = Velocity * DeltaTime;
+
+    uint8 Blocked = 0;
+    FVector Moved = World.VoxelSlideBox(Start, Extent, Delta, Blocked);
+
+    // Walking into a ledge no higher than MaxStepHeight: go up, across, then back down onto it
+    constexpr uint8 HorizontalAxes = (1 << 0) | (1 << 1);
+    if (bWasOnGround && (Blocked & HorizontalAxes) && MaxStepHeight > 0.f)
+    {
+        uint8 UpBlocked = 0, AcrossBlocked = 0, DownBlocked = 0;
+        const FVector Up = World.VoxelSlideBox(Start, Extent, FVector(0.f, 0.f, MaxStepHeight), UpBlocked);
+        const FVector Across = World.VoxelSlideBox(Start + Up, Extent, FVector(Delta.X, Delta.Y, 0.f), AcrossBlocked);
+        const FVector Down = World.VoxelSlideBox(Start + Up + Across, Extent, FVector(0.f, 0.f, -Up.Z), DownBlocked);
+        if (Across.SizeSquared2D() > Moved.SizeSquared2D() + KINDA_SMALL_NUMBER)
+        {
+            Moved = Up + Across + Down;
+            Blocked = AcrossBlocked & HorizontalAxes;
+        }
+    }
+
+    // Voxels only: no physics sweep
+    MoveUpdatedComponent(Moved, UpdatedComponent->GetComponentQuat(), /*bSweep*/false);
+
+    if (Blocked & (1 << 0)) Velocity.X = 0.f;
+    if (Blocked & (1 << 1)) Velocity.Y = 0.f;
+    if (Blocked & (1 << 2)) Velocity.Z = 0.f;
+
+    // Ground check from a short probe (not from history), so replayed moves reach the same answer
+    uint8 ProbeBlocked = 0;
+    World.VoxelSlideBox(Start + Moved, Extent, FVector(0.f, 0.f, -VoxelGroundProbe), ProbeBlocked);
+    const bool bOnGround = (ProbeBlocked & (1 << 2)) && Velocity.Z <= 0.f;
+
+    if (bOnGround && !bWasOnGround)
+    {
+        // Same order as ProcessLanded: notify, then switch to ground movement (resets the jump state)
+        FHitResult Hit(1.f);
+        Hit.bBlockingHit = true;
+        Hit.Location = UpdatedComponent->GetComponentLocation();
+        Hit.ImpactPoint = Hit.Location - FVector(0.f, 0.f, Extent.Z);
+        Hit.Normal = Hit.ImpactNormal = FVector::UpVector;
+        if (CharacterOwner)
+        {
+            CharacterOwner->Landed(Hit);
+        }
+        SetMovementMode(MOVE_Walking);
+    }
+    else if (!bOnGround && bWasOnGround)
+    {
+        SetMovementMode(MOVE_Falling);
+    }
+}
@@ -2,6 +2,7 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "KismetProceduralMeshLibrary.h"
 #include "VoxelMesher.h" // <-- for FVoxelMesher_Naive
+#include "VoxelChunkComponent.h"
 
 AVoxelChunkActor::AVoxelChunkActor()
 {
@@ -14,6 +15,9 @@ AVoxelChunkActor::AVoxelChunkActor()
     ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     ProcMesh->SetCollisionObjectType(ECC_WorldStatic);
     ProcMesh->SetCollisionResponseToAllChannels(ECR_Block);
+
+    ChunkMesh = CreateDefaultSubobject<UVoxelChunkComponent>(TEXT("ChunkMesh"));
+    ChunkMesh->SetupAttachment(ProcMesh);
 }
 
 void AVoxelChunkActor::BuildFromBuffers(const TArray<FVector>& Vertices,
@@ -58,6 +62,115 @@ void AVoxelChunkActor::BuildFromBuffers(const TArray<FVector>& Vertices,
     ProcMesh->CreateMeshSection_LinearColor(
         0, Vertices, Triangles, UseNormals, UVs, Colors, UseTangents, /*bCreateCollision*/ true);
 
+    ApplySectionSettings(UseMaterial);
+}
+
+int32 AVoxelChunkActor::MoveIntoSlots(TArray<FProcMeshSection>* Sections, uint32 Mask, int32 FirstSlot)
+{
+    // First build: create every slot at once (empty) so the moves below have somewhere to land.
+    if (!ProcMesh->GetProcMeshSection(FirstCollisionSection + CHUNK_NUM_SECTIONS - 1))
+    {
+        ProcMesh->SetProcMeshSection(FirstCollisionSection + CHUNK_NUM_SECTIONS - 1, FProcMeshSection());
+    }
+
+    // Move the worker's buffers straight into the existing slots
+    int32 LastSet = INDEX_NONE;
+    for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+    {
+        if (!(Mask & (1u << s))) continue;
+
+        FProcMeshSection* Slot = ProcMesh->GetProcMeshSection(FirstSlot + s);
+        if (!Sections)
+        {
+            *Slot = FProcMeshSection();
+        }
+        else if (Sections->IsValidIndex(s))
+        {
+            *Slot = MoveTemp((*Sections)[s]);
+        }
+        else
+        {
+            continue;
+        }
+        LastSet = FirstSlot + s;
+    }
+    return LastSet;
+}
+
+void AVoxelChunkActor::RefreshSlots(int32 LastSlot)
+{
+    // Hand one slot back to SetProcMeshSection. Assigning a section onto itself copies nothing but
+    // refreshes bounds, collision and render state once for the whole batch.
+    // The render state refresh recreates the procedural proxy, which re-uploads EVERY section of the component, so on
+    // this path a slab edit saves meshing work but not upload. Only the packed path (UVoxelChunkComponent) uploads per slab.
+    if (LastSlot != INDEX_NONE)
+    {
+        ProcMesh->SetProcMeshSection(LastSlot, *ProcMesh->GetProcMeshSection(LastSlot));
+    }
+}
+
+void AVoxelChunkActor::BuildFromSections(TArray<FProcMeshSection>& Sections, uint32 SectionMask, UMaterialInterface* UseMaterial,
+    TArray<FProcMeshSection>* CollisionSections, uint32 CollisionMask)
+{
+    const int32 LastRender = MoveIntoSlots(&Sections, SectionMask, 0);
+    const int32 LastCollision = MoveIntoSlots(CollisionSections, CollisionMask, FirstCollisionSection);
+    RefreshSlots(FMath::Max(LastRender, LastCollision));
+
+    // Switching back from the packed path: drop the packed copy.
+    if (ChunkMesh && ChunkMesh->GetNumPackedVertices() > 0)
+    {
+        ChunkMesh->ClearPackedVertices();
+    }
+
+    ApplySectionSettings(UseMaterial);
+}
+
+void AVoxelChunkActor::BuildFromPacked(TArray<TArray<FVoxelPackedVertex>>& Packed, const TArray<FBox>& VoxelBounds, uint32 SectionMask,
+    TArray<FProcMeshSection>* CollisionSections, uint32 CollisionMask, UMaterialInterface* UseMaterial)
+{
+    // Render slots stay empty on this path (switching from the procedural path frees them)
+    const int32 LastRender = MoveIntoSlots(nullptr, SectionMask, 0);
+    const int32 LastCollision = MoveIntoSlots(CollisionSections, CollisionMask, FirstCollisionSection);
+    RefreshSlots(FMath::Max(LastRender, LastCollision));
+    ApplySectionSettings(UseMaterial);
+
+    ChunkMesh->BlockSize = BlockSize;
+    ChunkMesh->SetPackedSections(Packed, VoxelBounds, SectionMask);
+    if (UseMaterial)
+    {
+        ChunkMesh->SetMaterial(0, UseMaterial);
+    }
+    ChunkMesh->SetVisibility(bRenderMeshes);
+}
+
+void AVoxelChunkActor::BuildFromLOD(TArray<FProcMeshSection>& Sections, TArray<TArray<FVoxelPackedVertex>>& Packed,
+    const TArray<FBox>& PackedVoxelBounds, bool bPacked, UMaterialInterface* UseMaterial)
+{
+    if (bPacked)
+    {
+        BuildFromPacked(Packed, PackedVoxelBounds, 1u, /*CollisionSections*/nullptr, 0, UseMaterial);
+    }
+    else
+    {
+        BuildFromSections(Sections, 1u, UseMaterial);
+    }
+
+    // Nothing to collide with out there; also keeps far chunks out of physics queries.
+    ProcMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+}
+
+void AVoxelChunkActor::SetCollisionSections(TArray<FProcMeshSection>& CollisionSections, uint32 CollisionMask)
+{
+    RefreshSlots(MoveIntoSlots(&CollisionSections, CollisionMask, FirstCollisionSection));
+}
+
+void AVoxelChunkActor::ClearCollision()
+{
+    RefreshSlots(MoveIntoSlots(nullptr, CHUNK_ALL_SECTIONS, FirstCollisionSection));
+}
+
+void AVoxelChunkActor::ApplySectionSettings(UMaterialInterface* UseMaterial)
+{
     // Collision (as you had it)
     ProcMesh->bUseAsyncCooking = true;
     ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
@@ -74,7 +187,10 @@ void AVoxelChunkActor::BuildFromBuffers(const TArray<FVector>& Vertices,
 
     if (UseMaterial)
     {
-        ProcMesh->SetMaterial(0, UseMaterial);
+        for (int32 s = 0; s < ProcMesh->GetNumSections(); ++s)
+        {
+            ProcMesh->SetMaterial(s, UseMaterial);
+        }
     }
 
     ProcMesh->SetVisibility(bRenderMeshes, /*bPropagateToChildren=*/true);
@@ -84,17 +200,18 @@ void AVoxelChunkActor::BuildFromChunk(const FVoxelChunkData& Chunk, float InBloc
 {
     BlockSize = InBlockSize;
 
-    TArray<FVector> V;
-    TArray<int32>   I;
-    TArray<FVector> N;
-    TArray<FVector2D> UV;
-    TArray<FLinearColor> C;
-    TArray<FProcMeshTangent> T;
-
-    // Naive mesher (Phase 3 path)
-    FVoxelMesher_Naive::BuildMesh(Chunk, BlockSize, V, I, N, UV, C, T);
+    // Naive mesher (Phase 3 path), one render and one collision section per vertical slab
+    TArray<FProcMeshSection> Sections;
+    TArray<FProcMeshSection> CollisionSections;
+    Sections.SetNum(CHUNK_NUM_SECTIONS);
+    CollisionSections.SetNum(CHUNK_NUM_SECTIONS);
+    for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+    {
+        FVoxelMesher_Naive::BuildMeshSection(Chunk, BlockSize, Sections[s], /*Borders*/nullptr, s);
+        FVoxelMesher_Naive::BuildCollisionSection(Chunk, BlockSize, CollisionSections[s], /*Borders*/nullptr, s);
+    }
 
-    BuildFromBuffers(V, I, N, UV, C, T, UseMaterial);
+    BuildFromSections(Sections, CHUNK_ALL_SECTIONS, UseMaterial, &CollisionSections, CHUNK_ALL_SECTIONS);
 }
 
 void AVoxelChunkActor::SetRenderMeshes(bool bInRender)
@@ -0,0 +1,337 @@
+#include "VoxelChunkComponent.h"
+#include "PrimitiveSceneProxy.h"
+#include "PrimitiveViewRelevance.h"
+#include "LocalVertexFactory.h"
+#include "StaticMeshResources.h"   // FStaticMeshVertexBuffers
+#include "RawIndexBuffer.h"
+#include "MaterialDomain.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialRenderProxy.h"
+#include "SceneInterface.h"
+#include "RenderingThread.h"
+
+// -----------------------------------------------------------------------------
+// Scene proxy: one set of GPU buffers per vertical section, so a remeshed slab is re-uploaded on its own.
+// -----------------------------------------------------------------------------
+class FVoxelChunkSceneProxy final : public FPrimitiveSceneProxy
+{
+public:
+    FVoxelChunkSceneProxy(const UVoxelChunkComponent* Component)
+        : FPrimitiveSceneProxy(Component)
+        , BlockSize(Component->BlockSize)
+        , MaterialRelevance(Component->GetMaterialRelevance(GetScene().GetFeatureLevel()))
+    {
+        // Packed copies (8 bytes per vertex) until the render thread expands them.
+        for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+        {
+            PendingSections[s] = Component->GetPackedSection(s);
+        }
+
+        Material = Component->GetMaterial(0);
+        if (!Material)
+        {
+            Material = UMaterial::GetDefaultMaterial(MD_Surface);
+        }
+    }
+
+    virtual SIZE_T GetTypeHash() const override
+    {
+        static size_t UniquePointer;
+        return reinterpret_cast<size_t>(&UniquePointer);
+    }
+
+    virtual void CreateRenderThreadResources(FRHICommandListBase& RHICmdList) override
+    {
+        for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+        {
+            BuildSection(RHICmdList, s, PendingSections[s]);
+            PendingSections[s].Empty();
+        }
+    }
+
+    // Render thread: replace the sections in SectionMask (indexed like NewSections) and leave the others' buffers alone.
+    void UpdateSections_RenderThread(FRHICommandListBase& RHICmdList, const TArray<TArray<FVoxelPackedVertex>>& NewSections, uint32 SectionMask)
+    {
+        check(IsInRenderingThread());
+
+        for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+        {
+            if ((SectionMask & (1u << s)) && NewSections.IsValidIndex(s))
+            {
+                BuildSection(RHICmdList, s, NewSections[s]);
+            }
+        }
+
+        // The cached static draw commands point at the replaced vertex factories.
+        GetScene().UpdateCachedRenderStates(this);
+    }
+
+    // Sections change through UpdateSections_RenderThread and a re-cache, so they stay on the cached static path.
+    virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override
+    {
+        for (const TUniquePtr<FSectionResources>& Section : Sections)
+        {
+            if (!Section) continue;
+
+            FMeshBatch Mesh;
+            Mesh.VertexFactory = &Section->VertexFactory;
+            Mesh.MaterialRenderProxy = Material->GetRenderProxy();
+            Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+            Mesh.Type = PT_TriangleList;
+            Mesh.DepthPriorityGroup = SDPG_World;
+            Mesh.LODIndex = 0;
+            Mesh.CastShadow = true;
+            Mesh.bCanApplyViewModeOverrides = true;
+
+            FMeshBatchElement& BatchElement = Mesh.Elements[0];
+            BatchElement.IndexBuffer = &Section->IndexBuffer;
+            BatchElement.FirstIndex = 0;
+            BatchElement.NumPrimitives = Section->NumIndices / 3;
+            BatchElement.MinVertexIndex = 0;
+            BatchElement.MaxVertexIndex = Section->NumVertices - 1;
+
+            PDI->DrawMesh(Mesh, FLT_MAX);
+        }
+    }
+
+    virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override
+    {
+        FPrimitiveViewRelevance Result;
+        Result.bDrawRelevance = IsShown(View);
+        Result.bShadowRelevance = IsShadowCast(View);
+        Result.bStaticRelevance = true;
+        Result.bDynamicRelevance = false;
+        Result.bRenderInMainPass = ShouldRenderInMainPass();
+        Result.bUsesLightingChannels = GetLightingChannelMask() != GetDefaultLightingChannelMask();
+        Result.bRenderCustomDepth = ShouldRenderCustomDepth();
+        MaterialRelevance.SetPrimitiveViewRelevance(Result);
+        Result.bVelocityRelevance = DrawsVelocity() && Result.bOpaque && Result.bRenderInMainPass;
+        return Result;
+    }
+
+    virtual bool CanBeOccluded() const override
+    {
+        return !MaterialRelevance.bDisableDepthTest;
+    }
+
+    virtual uint32 GetMemoryFootprint() const override
+    {
+        return sizeof(*this) + GetAllocatedSize();
+    }
+
+    uint32 GetAllocatedSize() const
+    {
+        uint32 Size = FPrimitiveSceneProxy::GetAllocatedSize();
+        for (const TArray<FVoxelPackedVertex>& Pending : PendingSections)
+        {
+            Size += Pending.GetAllocatedSize();
+        }
+        return Size;
+    }
+
+private:
+    // GPU buffers of one vertical section.
+    struct FSectionResources
+    {
+        FSectionResources(ERHIFeatureLevel::Type FeatureLevel)
+            : VertexFactory(FeatureLevel, "FVoxelChunkSceneProxy")
+        {
+        }
+
+        ~FSectionResources()
+        {
+            VertexBuffers.PositionVertexBuffer.ReleaseResource();
+            VertexBuffers.StaticMeshVertexBuffer.ReleaseResource();
+            VertexBuffers.ColorVertexBuffer.ReleaseResource();
+            IndexBuffer.ReleaseResource();
+            VertexFactory.ReleaseResource();
+        }
+
+        FStaticMeshVertexBuffers VertexBuffers;
+        FRawStaticIndexBuffer IndexBuffer;
+        FLocalVertexFactory VertexFactory;
+        int32 NumVertices = 0;
+        int32 NumIndices = 0;
+    };
+
+    // (Re)create section s from its packed vertices; an empty section just frees its buffers.
+    void BuildSection(FRHICommandListBase& RHICmdList, int32 s, const TArray<FVoxelPackedVertex>& Packed)
+    {
+        Sections[s].Reset();
+
+        const int32 NumVerts = Packed.Num();
+        const int32 NumQuads = NumVerts / 4;
+        if (NumQuads == 0) return;
+
+        TUniquePtr<FSectionResources> Section = MakeUnique<FSectionResources>(GetScene().GetFeatureLevel());
+        FStaticMeshVertexBuffers& VertexBuffers = Section->VertexBuffers;
+
+        // Default (non full-precision) streams: half UVs and 8-bit packed tangent basis.
+        VertexBuffers.PositionVertexBuffer.Init(NumVerts);
+        VertexBuffers.StaticMeshVertexBuffer.Init(NumVerts, 1);
+        VertexBuffers.ColorVertexBuffer.Init(NumVerts);
+
+        for (int32 i = 0; i < NumVerts; ++i)
+        {
+            FVector3f Position, Normal, Tangent;
+            FVector2f UV;
+            FColor Color;
+            FVoxelMesher_Naive::DecodePackedVertex(Packed[i], BlockSize, Position, Normal, Tangent, UV, Color);
+
+            VertexBuffers.PositionVertexBuffer.VertexPosition(i) = Position;
+            VertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(i, Tangent, FVector3f::CrossProduct(Normal, Tangent), Normal);
+            VertexBuffers.StaticMeshVertexBuffer.SetVertexUV(i, 0, UV);
+            VertexBuffers.ColorVertexBuffer.VertexColor(i) = Color;
+        }
+
+        // Quads are implicit (4 vertices each); same winding as the procedural mesh path.
+        TArray<uint32> Indices;
+        Indices.SetNumUninitialized(NumQuads * 6);
+        for (int32 q = 0; q < NumQuads; ++q)
+        {
+            const uint32 Base = static_cast<uint32>(q * 4);
+            uint32* Tri = &Indices[q * 6];
+            Tri[0] = Base + 0; Tri[1] = Base + 2; Tri[2] = Base + 1;
+            Tri[3] = Base + 0; Tri[4] = Base + 3; Tri[5] = Base + 2;
+        }
+        Section->IndexBuffer.SetIndices(Indices, NumVerts > MAX_uint16 ? EIndexBufferStride::Force32Bit : EIndexBufferStride::Force16Bit);
+
+        Section->NumVertices = NumVerts;
+        Section->NumIndices = Indices.Num();
+
+        VertexBuffers.PositionVertexBuffer.InitResource(RHICmdList);
+        VertexBuffers.StaticMeshVertexBuffer.InitResource(RHICmdList);
+        VertexBuffers.ColorVertexBuffer.InitResource(RHICmdList);
+
+        FLocalVertexFactory::FDataType Data;
+        VertexBuffers.PositionVertexBuffer.BindPositionVertexBuffer(&Section->VertexFactory, Data);
+        VertexBuffers.StaticMeshVertexBuffer.BindTangentVertexBuffer(&Section->VertexFactory, Data);
+        VertexBuffers.StaticMeshVertexBuffer.BindPackedTexCoordVertexBuffer(&Section->VertexFactory, Data);
+        VertexBuffers.ColorVertexBuffer.BindColorVertexBuffer(&Section->VertexFactory, Data);
+        Section->VertexFactory.SetData(RHICmdList, Data);
+
+        Section->VertexFactory.InitResource(RHICmdList);
+        Section->IndexBuffer.InitResource(RHICmdList);
+
+        Sections[s] = MoveTemp(Section);
+    }
+
+    TArray<FVoxelPackedVertex> PendingSections[CHUNK_NUM_SECTIONS];
+    TUniquePtr<FSectionResources> Sections[CHUNK_NUM_SECTIONS];
+    float BlockSize = 100.f;
+
+    UMaterialInterface* Material = nullptr;
+    FMaterialRelevance MaterialRelevance;
+};
+
+// -----------------------------------------------------------------------------
+// Component
+// -----------------------------------------------------------------------------
+UVoxelChunkComponent::UVoxelChunkComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    PrimaryComponentTick.bCanEverTick = false;
+
+    // Render only; collision stays on the owning actor's procedural mesh.
+    SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    SetGenerateOverlapEvents(false);
+
+    CastShadow = true;
+    bCastDynamicShadow = true;
+
+    for (FBox& Box : SectionVoxelBounds)
+    {
+        Box = FBox(ForceInit);
+    }
+}
+
+void UVoxelChunkComponent::SetPackedSections(TArray<TArray<FVoxelPackedVertex>>& InSections, const TArray<FBox>& InVoxelBounds, uint32 SectionMask)
+{
+    for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+    {
+        if (!(SectionMask & (1u << s)) || !InSections.IsValidIndex(s)) continue;
+
+        PackedSections[s] = MoveTemp(InSections[s]);
+        SectionVoxelBounds[s] = InVoxelBounds.IsValidIndex(s) ? InVoxelBounds[s] : FBox(ForceInit);
+    }
+
+    UpdateLocalBox();
+    UpdateBounds();
+
+    // Live proxy: re-upload just these sections and push the new bounds. Otherwise (first build, or nothing left
+    // to draw) create or drop the proxy.
+    FVoxelChunkSceneProxy* Proxy = static_cast<FVoxelChunkSceneProxy*>(SceneProxy);
+    if (!Proxy || GetNumPackedVertices() == 0)
+    {
+        MarkRenderStateDirty();
+        return;
+    }
+
+    TArray<TArray<FVoxelPackedVertex>> Changed;
+    Changed.SetNum(CHUNK_NUM_SECTIONS);
+    for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+    {
+        if (SectionMask & (1u << s)) Changed[s] = PackedSections[s];
+    }
+
+    ENQUEUE_RENDER_COMMAND(UpdateVoxelChunkSections)(
+        [Proxy, Changed = MoveTemp(Changed), SectionMask](FRHICommandListImmediate& RHICmdList)
+        {
+            Proxy->UpdateSections_RenderThread(RHICmdList, Changed, SectionMask);
+        });
+    MarkRenderTransformDirty();
+}
+
+void UVoxelChunkComponent::ClearPackedVertices()
+{
+    for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+    {
+        PackedSections[s].Empty();
+        SectionVoxelBounds[s] = FBox(ForceInit);
+    }
+    LocalBox = FBox(ForceInit);
+
+    UpdateBounds();
+    MarkRenderStateDirty();
+}
+
+int32 UVoxelChunkComponent::GetNumPackedVertices() const
+{
+    int32 Num = 0;
+    for (const TArray<FVoxelPackedVertex>& Section : PackedSections)
+    {
+        Num += Section.Num();
+    }
+    return Num;
+}
+
+void UVoxelChunkComponent::UpdateLocalBox()
+{
+    FBox VoxelBox(ForceInit);
+    for (const FBox& Box : SectionVoxelBounds)
+    {
+        if (Box.IsValid) VoxelBox += Box;
+    }
+
+    // Voxel-unit corner bounds -> local space (cells are centered on X * BlockSize).
+    const float Half = BlockSize * 0.5f;
+    LocalBox = VoxelBox.IsValid
+        ? FBox(VoxelBox.Min * BlockSize - FVector(Half), VoxelBox.Max * BlockSize - FVector(Half))
+        : FBox(ForceInit);
+}
+
+FPrimitiveSceneProxy* UVoxelChunkComponent::CreateSceneProxy()
+{
+    if (GetNumPackedVertices() == 0) return nullptr;
+    return new FVoxelChunkSceneProxy(this);
+}
+
+FBoxSphereBounds UVoxelChunkComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+    const FBox Box = LocalBox.IsValid ? LocalBox : FBox(FVector::ZeroVector, FVector::ZeroVector);
+
+    FBoxSphereBounds Ret(Box.TransformBy(LocalToWorld));
+    Ret.BoxExtent *= BoundsScale;
+    Ret.SphereRadius *= BoundsScale;
+    return Ret;
+}
@@ -1,6 +1,38 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "VoxelCore.h"
+#include "VoxelStats.h"
+
+DEFINE_STAT(STAT_VoxelGenerate);
+DEFINE_STAT(STAT_VoxelDeltaLoad);
+DEFINE_STAT(STAT_VoxelContentDecode);
+DEFINE_STAT(STAT_VoxelContentEncode);
+DEFINE_STAT(STAT_VoxelMeshBuild);
+DEFINE_STAT(STAT_VoxelCollisionBuild);
+DEFINE_STAT(STAT_VoxelSave);
+DEFINE_STAT(STAT_VoxelDrain);
+DEFINE_STAT(STAT_VoxelActorSpawn);
+DEFINE_STAT(STAT_VoxelCollisionCook);
+DEFINE_STAT(STAT_VoxelStreamingUpdate);
+DEFINE_STAT(STAT_VoxelEditDrain);
+DEFINE_STAT(STAT_VoxelNetIngest);
+
+DEFINE_STAT(STAT_VoxelLoadedChunks);
+DEFINE_STAT(STAT_VoxelPendingBuilds);
+DEFINE_STAT(STAT_VoxelPendingLODBuilds);
+DEFINE_STAT(STAT_VoxelEditQueueDepth);
+DEFINE_STAT(STAT_VoxelQueuedOpChunks);
+DEFINE_STAT(STAT_VoxelContentRequests);
+DEFINE_STAT(STAT_VoxelContentEncodes);
+DEFINE_STAT(STAT_VoxelChunksDrained);
+DEFINE_STAT(STAT_VoxelVerticesDrained);
+DEFINE_STAT(STAT_VoxelMeshBytesDrained);
+DEFINE_STAT(STAT_VoxelNetBytesIn);
+DEFINE_STAT(STAT_VoxelNetBytesOut);
+DEFINE_STAT(STAT_VoxelVerticesPerChunk);
+DEFINE_STAT(STAT_VoxelMeshBytesPerChunk);
+
+CSV_DEFINE_CATEGORY(Voxel, true);
 
 #define LOCTEXT_NAMESPACE "FVoxelCoreModule"
 
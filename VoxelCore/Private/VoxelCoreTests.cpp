@@ -1,23 +1,39 @@
 #include "VoxelCore.h"
 #include "ChunkConfig.h"
+#include "ChunkHelpers.h"
 #include "VoxelTypes.h"
+#include "VoxelChunk.h"
+#include "VoxelGenerator.h"
+#include "VoxelMesher.h"
+#include "VoxelSaveSystem.h"
+#include "VoxelDeltaCodec.h"
+#include "WorldPersistence.h"
 #include "FastNoiseLite.h"
+#include "ProceduralMeshComponent.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 
 static FAutoConsoleCommand CmdVoxelTestSetup(
     TEXT("Voxel.TestSetup"),
     TEXT("Runs voxel core setup test to validate indexing + noise"),
     FConsoleCommandDelegate::CreateStatic([]()
         {
+            // Same layout as the chunk data: X + Z*CHUNK_SIZE_X + Y*CHUNK_SIZE_X*CHUNK_SIZE_Z
             int32 X = 5, Y = 10, Z = 2;
-            int32 Index = X + Y * CHUNK_SIZE_X + Z * CHUNK_SIZE_X * CHUNK_SIZE_Y;
+            int32 Index = IndexFromXYZ(X, Y, Z);
 
             FString IndexMsg = FString::Printf(TEXT("Index from (5,10,2) = %d"), Index);
             UE_LOG(LogTemp, Log, TEXT("%s"), *IndexMsg);
             if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Yellow, IndexMsg);
 
-            int32 OutX = Index % CHUNK_SIZE_X;
-            int32 OutY = (Index / CHUNK_SIZE_X) % CHUNK_SIZE_Y;
-            int32 OutZ = Index / (CHUNK_SIZE_X * CHUNK_SIZE_Y);
+            int32 OutX = 0, OutY = 0, OutZ = 0;
+            XYZFromIndex(Index, OutX, OutY, OutZ);
 
             FString CoordMsg = FString::Printf(TEXT("XYZ from index: (%d, %d, %d)"), OutX, OutY, OutZ);
             UE_LOG(LogTemp, Log, TEXT("%s"), *CoordMsg);
@@ -34,3 +50,411 @@ static FAutoConsoleCommand CmdVoxelTestSetup(
         })
 );
 
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------------------------------------------
+// Automation tests and benchmarks. The benchmarks need no world or renderer, so they run headless:
+//   UnrealEditor-Cmd <Project>.uproject -nullrhi -unattended -ExecCmds="Automation RunTests Voxel.Bench; Quit"
+// Each benchmark logs its results and writes them as JSON to Saved/Automation/VoxelBench/<Name>.json, for
+// comparing builds.
+// ---------------------------------------------------------------------------------------------------------------
+
+namespace VoxelBench
+{
+    static constexpr int32 Seed = 1337;
+
+    // A diagonal strip of chunks, so terrain height (and mesh size) varies between them
+    static FChunkKey ChunkKeyAt(int32 i)
+    {
+        return FChunkKey(i * 3 - 40, i * 2 - 25);
+    }
+
+    static void GenerateChunks(int32 Num, TArray<FVoxelChunkData>& OutChunks)
+    {
+        FVoxelGenerator Gen(Seed);
+        OutChunks.SetNum(Num);
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Gen.GenerateBaseChunk(ChunkKeyAt(i), OutChunks[i]);
+            OutChunks[i].RecomputeExtents();
+        }
+    }
+
+    // Num distinct random cells set to non-zero ids
+    static void AddRandomEdits(FVoxelChunkData& Chunk, int32 Num, FRandomStream& Rng)
+    {
+        Num = FMath::Min(Num, CHUNK_VOLUME);
+        while (Chunk.ModifiedBlocks.Num() < Num)
+        {
+            Chunk.ModifiedBlocks.Add(Rng.RandRange(0, CHUNK_VOLUME - 1), (uint16)Rng.RandRange(1, 255));
+        }
+    }
+
+    struct FReport
+    {
+        FString Name;
+        TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+        TArray<TSharedPtr<FJsonValue>> Results;
+
+        explicit FReport(const FString& InName)
+            : Name(InName)
+        {
+            Root->SetStringField(TEXT("benchmark"), Name);
+            Root->SetStringField(TEXT("build"), FApp::GetBuildVersion());
+            Root->SetStringField(TEXT("configuration"), LexToString(FApp::GetBuildConfiguration()));
+            Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+            Root->SetNumberField(TEXT("seed"), Seed);
+        }
+
+        TSharedRef<FJsonObject> AddResult(const FString& ResultName)
+        {
+            TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetStringField(TEXT("name"), ResultName);
+            Results.Add(MakeShared<FJsonValueObject>(Result));
+            return Result;
+        }
+
+        // One log line per report, plus Saved/Automation/VoxelBench/<Name>.json
+        bool Write(FAutomationTestBase& Test)
+        {
+            Root->SetArrayField(TEXT("results"), Results);
+
+            FString Json;
+            TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+            FJsonSerializer::Serialize(Root, Writer);
+            UE_LOG(LogTemp, Display, TEXT("VoxelBench %s"), *Json);
+
+            const FString Path = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("VoxelBench") / (Name + TEXT(".json"));
+            Test.AddInfo(FString::Printf(TEXT("Results written to %s"), *Path));
+            return FFileHelper::SaveStringToFile(Json, *Path);
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelIndexingTest, "Voxel.Core.Indexing",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelIndexingTest::RunTest(const FString& Parameters)
+{
+    // X fastest, then Z, then Y (one horizontal layer after another)
+    TestEqual(TEXT("X stride"), IndexFromXYZ(1, 0, 0), 1);
+    TestEqual(TEXT("Z stride"), IndexFromXYZ(0, 0, 1), CHUNK_SIZE_X);
+    TestEqual(TEXT("Y stride"), IndexFromXYZ(0, 1, 0), CHUNK_SIZE_X * CHUNK_SIZE_Z);
+
+    int32 Mismatches = 0;
+    for (int32 Index = 0; Index < CHUNK_VOLUME; ++Index)
+    {
+        int32 X = 0, Y = 0, Z = 0;
+        XYZFromIndex(Index, X, Y, Z);
+        if (IndexFromXYZ(X, Y, Z) != Index) ++Mismatches;
+    }
+    TestEqual(TEXT("Index round trips"), Mismatches, 0);
+
+    FVoxelChunkData Chunk(FChunkKey(0, 0));
+    Chunk.SetBlockAt(3, 70, 9, EBlockId::Stone);
+    TestEqual(TEXT("Edit lands at IndexFromXYZ"), (int32)Chunk.ModifiedBlocks.FindRef(IndexFromXYZ(3, 70, 9)), (int32)EBlockId::Stone);
+    TestEqual(TEXT("Edit reads back"), Chunk.GetBlockAt(3, 70, 9), EBlockId::Stone);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelDeltaCodecTest, "Voxel.Core.DeltaCodec",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelDeltaCodecTest::RunTest(const FString& Parameters)
+{
+    FRandomStream Rng(7);
+    TArray<FVoxelCellOp> Ops;
+    TMap<int32, uint8> Expected;
+    for (int32 i = 0; i < 2000; ++i)
+    {
+        FVoxelCellOp& Op = Ops.AddDefaulted_GetRef();
+        Op.LocalIndex = Rng.RandRange(0, CHUNK_VOLUME - 1);
+        Op.BlockId = (uint8)Rng.RandRange(0, 8);
+        Expected.Add(Op.LocalIndex, Op.BlockId);
+    }
+
+    TArray<uint8> Payload;
+    VoxelDeltaCodec::Encode(Ops, Payload);
+    TArray<FVoxelCellOp> Decoded;
+    TestTrue(TEXT("Ops decode"), VoxelDeltaCodec::Decode(Payload, Decoded));
+    TestEqual(TEXT("Last op per cell survives"), Decoded.Num(), Expected.Num());
+    for (const FVoxelCellOp& Op : Decoded)
+    {
+        if (Expected.FindRef(Op.LocalIndex) != Op.BlockId)
+        {
+            AddError(FString::Printf(TEXT("Cell %d decoded as %d"), Op.LocalIndex, Op.BlockId));
+            break;
+        }
+    }
+
+    TArray<FVoxelChunkData> Chunks;
+    VoxelBench::GenerateChunks(1, Chunks);
+    VoxelDeltaCodec::EncodeBlocks(Chunks[0].Blocks, Payload);
+    TArray<uint8> Blocks;
+    TestTrue(TEXT("Blocks decode"), VoxelDeltaCodec::DecodeBlocks(Payload, Blocks));
+    TestTrue(TEXT("Blocks round trip"), Blocks == Chunks[0].Blocks);
+
+    // Truncated payloads are rejected, not half-applied
+    Payload.SetNum(Payload.Num() / 2);
+    TestFalse(TEXT("Truncated blocks rejected"), VoxelDeltaCodec::DecodeBlocks(Payload, Blocks));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelStreamedContentTest, "Voxel.Core.StreamedContent",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelStreamedContentTest::RunTest(const FString& Parameters)
+{
+    constexpr float BlockSize = 100.f;
+    TArray<FVoxelChunkData> Chunks;
+    VoxelBench::GenerateChunks(1, Chunks);
+    const FVoxelChunkData& Generated = Chunks[0];
+
+    // What a client builds from streamed contents instead of generating the chunk
+    TArray<uint8> Payload;
+    VoxelDeltaCodec::EncodeBlocks(Generated.Blocks, Payload);
+    FVoxelChunkData Streamed(Generated.Key);
+    TestTrue(TEXT("Blocks decode"), VoxelDeltaCodec::DecodeBlocks(Payload, Streamed.Blocks));
+    Streamed.RecomputeExtents();
+
+    // The mesher skips columns and slabs by the extents, so stale ones mesh nothing
+    TestFalse(TEXT("Streamed chunk has extents"), Streamed.IsEmpty());
+
+    FProcMeshSection GeneratedSection, StreamedSection;
+    FVoxelMesher_Naive::BuildMeshSection(Generated, BlockSize, GeneratedSection);
+    FVoxelMesher_Naive::BuildMeshSection(Streamed, BlockSize, StreamedSection);
+    TestTrue(TEXT("Generated chunk meshes"), GeneratedSection.ProcVertexBuffer.Num() > 0);
+    TestEqual(TEXT("Streamed chunk meshes like the generated one"), StreamedSection.ProcVertexBuffer.Num(), GeneratedSection.ProcVertexBuffer.Num());
+
+    TArray<FVoxelPackedVertex> GeneratedPacked, StreamedPacked;
+    FBox GeneratedBounds(ForceInit), StreamedBounds(ForceInit);
+    FVoxelMesher_Naive::BuildPackedMesh(Generated, GeneratedPacked, GeneratedBounds);
+    FVoxelMesher_Naive::BuildPackedMesh(Streamed, StreamedPacked, StreamedBounds);
+    TestEqual(TEXT("Streamed chunk packs like the generated one"), StreamedPacked.Num(), GeneratedPacked.Num());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBenchGeneration, "Voxel.Bench.Generation",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVoxelBenchGeneration::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumChunks = 256;
+    VoxelBench::FReport Report(TEXT("Generation"));
+
+    FVoxelGenerator Gen(VoxelBench::Seed);
+    FVoxelChunkData Warmup;
+    Gen.GenerateBaseChunk(VoxelBench::ChunkKeyAt(0), Warmup);
+
+    TArray<FVoxelChunkData> Chunks;
+    Chunks.SetNum(NumChunks);
+    const double Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumChunks; ++i)
+    {
+        Gen.GenerateBaseChunk(VoxelBench::ChunkKeyAt(i), Chunks[i]);
+    }
+    const double Seconds = FPlatformTime::Seconds() - Start;
+
+    // Size of each chunk as a streamed payload (what a client downloads instead of generating it)
+    int64 PayloadBytes = 0;
+    const double EncodeStart = FPlatformTime::Seconds();
+    for (const FVoxelChunkData& Chunk : Chunks)
+    {
+        TArray<uint8> Payload;
+        VoxelDeltaCodec::EncodeBlocks(Chunk.Blocks, Payload);
+        PayloadBytes += Payload.Num();
+    }
+    const double EncodeSeconds = FPlatformTime::Seconds() - EncodeStart;
+
+    TSharedRef<FJsonObject> Result = Report.AddResult(TEXT("GenerateBaseChunk"));
+    Result->SetNumberField(TEXT("chunks"), NumChunks);
+    Result->SetNumberField(TEXT("chunks_per_sec"), NumChunks / FMath::Max(Seconds, 1e-9));
+    Result->SetNumberField(TEXT("ms_per_chunk"), Seconds * 1000.0 / NumChunks);
+
+    TSharedRef<FJsonObject> Encode = Report.AddResult(TEXT("EncodeBlocks"));
+    Encode->SetNumberField(TEXT("ms_per_chunk"), EncodeSeconds * 1000.0 / NumChunks);
+    Encode->SetNumberField(TEXT("bytes_per_chunk"), (double)PayloadBytes / NumChunks);
+
+    TestTrue(TEXT("Report written"), Report.Write(*this));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBenchMeshing, "Voxel.Bench.Meshing",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVoxelBenchMeshing::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumChunks = 64;
+    constexpr float BlockSize = 100.f;
+    VoxelBench::FReport Report(TEXT("Meshing"));
+
+    TArray<FVoxelChunkData> Chunks;
+    VoxelBench::GenerateChunks(NumChunks, Chunks);
+
+    // Whole chunks without neighbor borders (every side counts as air), one mesher at a time.
+    // Build returns the vertex count of one chunk.
+    auto RunMesher = [&](const TCHAR* Name, TFunctionRef<int32(const FVoxelChunkData&)> Build)
+        {
+            Build(Chunks[0]);   // warm-up
+
+            int64 Vertices = 0;
+            const double Start = FPlatformTime::Seconds();
+            for (const FVoxelChunkData& Chunk : Chunks)
+            {
+                Vertices += Build(Chunk);
+            }
+            const double Seconds = FPlatformTime::Seconds() - Start;
+
+            TSharedRef<FJsonObject> Result = Report.AddResult(Name);
+            Result->SetNumberField(TEXT("chunks"), NumChunks);
+            Result->SetNumberField(TEXT("builds_per_sec"), NumChunks / FMath::Max(Seconds, 1e-9));
+            Result->SetNumberField(TEXT("ms_per_chunk"), Seconds * 1000.0 / NumChunks);
+            Result->SetNumberField(TEXT("vertices_per_chunk"), (double)Vertices / NumChunks);
+        };
+
+    RunMesher(TEXT("BuildMeshSection"), [BlockSize](const FVoxelChunkData& Chunk)
+        {
+            FProcMeshSection Section;
+            FVoxelMesher_Naive::BuildMeshSection(Chunk, BlockSize, Section);
+            return Section.ProcVertexBuffer.Num();
+        });
+    RunMesher(TEXT("BuildPackedMesh"), [](const FVoxelChunkData& Chunk)
+        {
+            TArray<FVoxelPackedVertex> Vertices;
+            FBox Bounds(ForceInit);
+            FVoxelMesher_Naive::BuildPackedMesh(Chunk, Vertices, Bounds);
+            return Vertices.Num();
+        });
+    RunMesher(TEXT("BuildCollisionSection"), [BlockSize](const FVoxelChunkData& Chunk)
+        {
+            FProcMeshSection Section;
+            FVoxelMesher_Naive::BuildCollisionSection(Chunk, BlockSize, Section);
+            return Section.ProcVertexBuffer.Num();
+        });
+    for (int32 LOD = 1; LOD <= VOXEL_MAX_LOD; ++LOD)
+    {
+        RunMesher(*FString::Printf(TEXT("BuildLODMeshSection_LOD%d"), LOD), [BlockSize, LOD](const FVoxelChunkData& Chunk)
+            {
+                FProcMeshSection Section;
+                FVoxelMesher_Naive::BuildLODMeshSection(Chunk, BlockSize, LOD, Section);
+                return Section.ProcVertexBuffer.Num();
+            });
+    }
+
+    TestTrue(TEXT("Report written"), Report.Write(*this));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBenchPersistence, "Voxel.Bench.Persistence",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVoxelBenchPersistence::RunTest(const FString& Parameters)
+{
+    constexpr int32 Iterations = 32;
+    const FString WorldName = TEXT("__VoxelBench__");
+    const int32 Densities[] = { 16, 256, 4096, CHUNK_VOLUME };
+    VoxelBench::FReport Report(TEXT("Persistence"));
+
+    for (const int32 Density : Densities)
+    {
+        FRandomStream Rng(Density);
+        FVoxelChunkData Chunk(VoxelBench::ChunkKeyAt(Density));
+        VoxelBench::AddRandomEdits(Chunk, Density, Rng);
+
+        VoxelSaveSystem::SaveDeltaByWorld(WorldName, Chunk);   // warm-up (creates the folders)
+
+        double SaveSeconds = 0.0, LoadSeconds = 0.0;
+        bool bLoadedAll = true;
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            double Start = FPlatformTime::Seconds();
+            VoxelSaveSystem::SaveDeltaByWorld(WorldName, Chunk);
+            SaveSeconds += FPlatformTime::Seconds() - Start;
+
+            FVoxelChunkData Loaded(Chunk.Key);
+            Start = FPlatformTime::Seconds();
+            VoxelSaveSystem::LoadDeltaByWorld(WorldName, Loaded);
+            LoadSeconds += FPlatformTime::Seconds() - Start;
+            bLoadedAll &= (Loaded.ModifiedBlocks.Num() == Chunk.ModifiedBlocks.Num());
+        }
+        TestTrue(*FString::Printf(TEXT("%d edits load back"), Density), bLoadedAll);
+
+        const FString File = VoxelPaths::ChunksDir(WorldName) / FString::Printf(TEXT("%d_%d.bin"), Chunk.Key.X, Chunk.Key.Z);
+        TSharedRef<FJsonObject> Result = Report.AddResult(FString::Printf(TEXT("Delta_%d"), Density));
+        Result->SetNumberField(TEXT("modified_cells"), Density);
+        Result->SetNumberField(TEXT("save_ms"), SaveSeconds * 1000.0 / Iterations);
+        Result->SetNumberField(TEXT("load_ms"), LoadSeconds * 1000.0 / Iterations);
+        Result->SetNumberField(TEXT("file_bytes"), (double)IFileManager::Get().FileSize(*File));
+    }
+
+    IFileManager::Get().DeleteDirectory(*VoxelPaths::WorldDir(WorldName), /*RequireExists*/false, /*Tree*/true);
+
+    TestTrue(TEXT("Report written"), Report.Write(*this));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBenchEditApply, "Voxel.Bench.EditApply",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVoxelBenchEditApply::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumEdits = 16384;
+    constexpr int32 NumRemeshes = 64;
+    constexpr float BlockSize = 100.f;
+    const int32 Densities[] = { 0, 1024, 16384 };
+    VoxelBench::FReport Report(TEXT("EditApply"));
+
+    TArray<FVoxelChunkData> Generated;
+    VoxelBench::GenerateChunks(1, Generated);
+
+    for (const int32 Density : Densities)
+    {
+        FRandomStream Rng(Density + 1);
+        FVoxelChunkData Chunk = Generated[0];
+        VoxelBench::AddRandomEdits(Chunk, Density, Rng);
+        Chunk.RecomputeExtents();
+
+        // Random edits can repeat a cell, so the chunk may hold fewer than Density
+        const int32 ModifiedBefore = Chunk.ModifiedBlocks.Num();
+
+        TArray<FVoxelCellOp> Ops;
+        Ops.SetNum(NumEdits);
+        for (FVoxelCellOp& Op : Ops)
+        {
+            Op.LocalIndex = Rng.RandRange(0, CHUNK_VOLUME - 1);
+            Op.BlockId = (uint8)Rng.RandRange(0, 8);
+        }
+
+        // Chunk data: delta map plus column extents, what every applied edit pays on server and client
+        double Start = FPlatformTime::Seconds();
+        for (const FVoxelCellOp& Op : Ops)
+        {
+            int32 X = 0, Y = 0, Z = 0;
+            XYZFromIndex(Op.LocalIndex, X, Y, Z);
+            Chunk.SetBlockAt(X, Y, Z, (EBlockId)Op.BlockId);
+        }
+        const double DataSeconds = FPlatformTime::Seconds() - Start;
+
+        // Remesh of the section an edit lands in (the game-thread-free half of the visible cost)
+        Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumRemeshes; ++i)
+        {
+            int32 X = 0, Y = 0, Z = 0;
+            XYZFromIndex(Ops[i].LocalIndex, X, Y, Z);
+            FProcMeshSection Section;
+            FVoxelMesher_Naive::BuildMeshSection(Chunk, BlockSize, Section, nullptr, Y / CHUNK_SECTION_SIZE_Y);
+        }
+        const double RemeshSeconds = FPlatformTime::Seconds() - Start;
+
+        TSharedRef<FJsonObject> Result = Report.AddResult(FString::Printf(TEXT("Edits_%d"), Density));
+        Result->SetNumberField(TEXT("modified_cells_before"), ModifiedBefore);
+        Result->SetNumberField(TEXT("set_block_us"), DataSeconds * 1e6 / NumEdits);
+        Result->SetNumberField(TEXT("section_remesh_ms"), RemeshSeconds * 1000.0 / NumRemeshes);
+    }
+
+    TestTrue(TEXT("Report written"), Report.Write(*this));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,213 @@
+#include "VoxelDeltaCodec.h"
+#include "ChunkConfig.h"
+#include "Misc/Compression.h"
+#include "VoxelKernel/RunCodec.h"
+#include "VoxelStats.h"
+
+// Run bodies are written and read by VoxelKernel (RunCodec.h); this adds the flag byte and zlib on top.
+namespace VoxelDeltaCodec
+{
+    enum : uint8
+    {
+        FlagCompressed = 1 << 0,
+    };
+
+    static void WriteBody(const TArray<FVoxelCellOp>& Ops, std::vector<uint8>& OutBody)
+    {
+        TArray<VoxelKernel::FCellValue> Cells;
+        Cells.SetNumUninitialized(Ops.Num());
+        for (int32 i = 0; i < Ops.Num(); ++i)
+        {
+            Cells[i].Index = Ops[i].LocalIndex;
+            Cells[i].Id = Ops[i].BlockId;
+        }
+        VoxelKernel::WriteCellRuns(Cells.GetData(), Cells.Num(), OutBody);
+    }
+
+    static bool ReadBody(const uint8* Data, int32 NumBytes, TArray<FVoxelCellOp>& OutOps)
+    {
+        return VoxelKernel::ReadRuns(Data, NumBytes, [&OutOps](int32 Start, int32 End, uint8 Id)
+            {
+                for (int32 Index = Start; Index < End; ++Index)
+                {
+                    FVoxelCellOp& Op = OutOps.AddDefaulted_GetRef();
+                    Op.LocalIndex = Index;
+                    Op.BlockId = Id;
+                }
+            });
+    }
+
+    // Flag byte, then the body as is or zlib-compressed (with its raw size) when that is smaller
+    static void Pack(const std::vector<uint8>& Body, TArray<uint8>& OutPayload, int32 CompressThresholdBytes)
+    {
+        const int32 BodyBytes = (int32)Body.size();
+        OutPayload.Reset();
+        if (BodyBytes > CompressThresholdBytes)
+        {
+            int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, BodyBytes);
+            TArray<uint8> Compressed;
+            Compressed.SetNumUninitialized(CompressedSize);
+            if (FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Body.data(), BodyBytes)
+                && CompressedSize + 4 < BodyBytes)
+            {
+                const uint32 RawSize = BodyBytes;
+                OutPayload.Add(FlagCompressed);
+                OutPayload.Append(reinterpret_cast<const uint8*>(&RawSize), 4);
+                OutPayload.Append(Compressed.GetData(), CompressedSize);
+                return;
+            }
+        }
+
+        OutPayload.Add(0);
+        OutPayload.Append(Body.data(), BodyBytes);
+    }
+
+    // The body of a Pack payload: OutData points into Payload, or into Scratch if it was compressed
+    static bool Unpack(const TArray<uint8>& Payload, TArray<uint8>& Scratch, const uint8*& OutData, int32& OutNum)
+    {
+        if (Payload.Num() < 1) return false;
+
+        const uint8 Flags = Payload[0];
+        if (Flags & FlagCompressed)
+        {
+            if (Payload.Num() < 5) return false;
+            uint32 RawSize = 0;
+            FMemory::Memcpy(&RawSize, Payload.GetData() + 1, 4);
+            if (RawSize == 0 || RawSize > (uint32)MaxPayloadBytes) return false;
+
+            Scratch.SetNumUninitialized(RawSize);
+            if (!FCompression::UncompressMemory(NAME_Zlib, Scratch.GetData(), RawSize, Payload.GetData() + 5, Payload.Num() - 5))
+                return false;
+            OutData = Scratch.GetData();
+            OutNum = Scratch.Num();
+            return true;
+        }
+
+        if (Payload.Num() - 1 > MaxPayloadBytes) return false;
+        OutData = Payload.GetData() + 1;
+        OutNum = Payload.Num() - 1;
+        return true;
+    }
+
+    void Encode(const TArray<FVoxelCellOp>& Ops, TArray<uint8>& OutPayload, int32 CompressThresholdBytes)
+    {
+        std::vector<uint8> Body;
+        WriteBody(Ops, Body);
+        Pack(Body, OutPayload, CompressThresholdBytes);
+    }
+
+    bool Decode(const TArray<uint8>& Payload, TArray<FVoxelCellOp>& OutOps)
+    {
+        OutOps.Reset();
+
+        TArray<uint8> Scratch;
+        const uint8* Body = nullptr;
+        int32 BodyBytes = 0;
+        const bool bOk = Unpack(Payload, Scratch, Body, BodyBytes) && ReadBody(Body, BodyBytes, OutOps);
+
+        if (!bOk) OutOps.Reset();
+        return bOk;
+    }
+
+    void EncodeBlocks(const TArray<uint8>& Blocks, TArray<uint8>& OutPayload, int32 CompressThresholdBytes)
+    {
+        check(Blocks.Num() == CHUNK_VOLUME);
+
+        std::vector<uint8> Body;
+        VoxelKernel::WriteBlockRuns(Blocks.GetData(), Body);
+        Pack(Body, OutPayload, CompressThresholdBytes);
+    }
+
+    bool DecodeBlocks(const TArray<uint8>& Payload, TArray<uint8>& OutBlocks)
+    {
+        TArray<uint8> Scratch;
+        const uint8* Body = nullptr;
+        int32 BodyBytes = 0;
+        if (!Unpack(Payload, Scratch, Body, BodyBytes)) return false;
+
+        OutBlocks.SetNumUninitialized(CHUNK_VOLUME);
+        return VoxelKernel::ReadBlockRuns(Body, BodyBytes, OutBlocks.GetData());
+    }
+}
+
+bool FVoxelChunkDelta::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar << ChunkXZ.X;
+    Ar << ChunkXZ.Y;
+
+    // Sequences only grow and a delta spans few of them: packed From + span
+    uint32 From = (uint32)FMath::Max(FromSeq, 0);
+    uint32 Span = (uint32)FMath::Max(ToSeq - FromSeq, 0);
+    Ar.SerializeIntPacked(From);
+    Ar.SerializeIntPacked(Span);
+
+    uint8 Flags = (bReset ? 1 : 0) | (bMore ? 2 : 0);
+    Ar.SerializeBits(&Flags, 2);
+
+    uint32 PayloadBytes = 0;
+    if (Ar.IsSaving())
+    {
+        if (EncodedOps.Num() == 0)
+        {
+            VoxelDeltaCodec::Encode(Ops, EncodedOps);
+        }
+        PayloadBytes = EncodedOps.Num();
+        Ar.SerializeIntPacked(PayloadBytes);
+        Ar.Serialize(EncodedOps.GetData(), PayloadBytes);
+        VOXEL_COUNT(NetBytesOut, PayloadBytes);
+        bOutSuccess = !Ar.IsError();
+        return true;
+    }
+
+    FromSeq = (int32)From;
+    ToSeq = (int32)(From + Span);
+    bReset = (Flags & 1) != 0;
+    bMore = (Flags & 2) != 0;
+
+    Ar.SerializeIntPacked(PayloadBytes);
+    if (Ar.IsError() || PayloadBytes == 0 || PayloadBytes > (uint32)VoxelDeltaCodec::MaxPayloadBytes)
+    {
+        Ar.SetError();
+        bOutSuccess = false;
+        return true;
+    }
+
+    TArray<uint8> Payload;
+    Payload.SetNumUninitialized(PayloadBytes);
+    Ar.Serialize(Payload.GetData(), PayloadBytes);
+    VOXEL_COUNT(NetBytesIn, PayloadBytes);
+    bOutSuccess = !Ar.IsError() && VoxelDeltaCodec::Decode(Payload, Ops);
+    return true;
+}
+
+bool FVoxelChunkContent::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar << ChunkXZ.X;
+    Ar << ChunkXZ.Y;
+    Ar << Hash;
+
+    // Already encoded by the sender: raw bytes, no per-element property overhead
+    uint32 PayloadBytes = Payload.Num();
+    Ar.SerializeIntPacked(PayloadBytes);
+    if (Ar.IsLoading())
+    {
+        if (Ar.IsError() || PayloadBytes > (uint32)VoxelDeltaCodec::MaxPayloadBytes)
+        {
+            Ar.SetError();
+            bOutSuccess = false;
+            return true;
+        }
+        Payload.SetNumUninitialized(PayloadBytes);
+    }
+    Ar.Serialize(Payload.GetData(), PayloadBytes);
+    if (Ar.IsLoading())
+    {
+        VOXEL_COUNT(NetBytesIn, PayloadBytes);
+    }
+    else
+    {
+        VOXEL_COUNT(NetBytesOut, PayloadBytes);
+    }
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
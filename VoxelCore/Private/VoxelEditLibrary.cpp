@@ -1,7 +1,7 @@
 ﻿#include "VoxelEditLibrary.h"                // MUST be first (IWYU)
 
 #include "VoxelWorldManager.h"
-#include "Kismet/GameplayStatics.h"
+#include "VoxelWorldSubsystem.h"
 #include "VoxelPlayerController.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
@@ -37,26 +37,52 @@ void UVoxelEditLibrary::Voxel_LineTraceAndRequestEdit(
 
 	const FVector Dir = ViewRot.Vector();
 	const float Reach = FMath::Clamp(MaxReach, 100.f, 800.f);
-	const FVector TraceEnd = ViewLoc + Dir * Reach;
 
-	FCollisionQueryParams QP(SCENE_QUERY_STAT(VoxelEditTrace), false);
-	QP.AddIgnoredActor(CharacterOrController);
+	AVoxelPlayerController* VPC = Cast<AVoxelPlayerController>(PC);
+	if (!VPC) return;
 
-	FHitResult Hit;
-	if (!World->LineTraceSingleByChannel(Hit, ViewLoc, TraceEnd, ECollisionChannel::ECC_Visibility, QP))
-		return;
+	// Local world data to aim with: the client-visual manager, else any manager (standalone)
+	AVoxelWorldManager* Mgr = VPC->ClientVisualManager;
+	if (!Mgr)
+	{
+		if (const UVoxelWorldSubsystem* Registry = UVoxelWorldSubsystem::Get(World))
+		{
+			Mgr = Registry->GetLocalManager();
+		}
+	}
 
-	// Build the request and send to server
+	// Build the request; the server re-runs the ray on its own data
 	FBlockEditRequest Req;
-	Req.WorldHitLocation = Hit.ImpactPoint;
-	Req.HitNormal = Hit.ImpactNormal;
+	Req.TraceStart = ViewLoc;
+	Req.TraceDirection = Dir;
 	Req.Action = Action;
 	Req.NewBlockId = NewBlockId;
 	Req.ClaimedReach = Reach;
 
-	if (AVoxelPlayerController* VPC = Cast<AVoxelPlayerController>(PC))
+	if (Mgr)
 	{
-		VPC->Server_RequestBlockEdit(Req);
+		// Grid walk over voxel data: works without any chunk collision
+		FVoxelRayHit VoxelHit;
+		if (!Mgr->VoxelRaycast(ViewLoc, Dir, Reach, VoxelHit))
+			return;
+
+		Req.WorldHitLocation = VoxelHit.WorldHitLocation;
+		Req.HitNormal = VoxelHit.HitNormal;
 	}
+	else
+	{
+		FCollisionQueryParams QP(SCENE_QUERY_STAT(VoxelEditTrace), false);
+		QP.AddIgnoredActor(CharacterOrController);
+
+		FHitResult Hit;
+		if (!World->LineTraceSingleByChannel(Hit, ViewLoc, ViewLoc + Dir * Reach, ECollisionChannel::ECC_Visibility, QP))
+			return;
+
+		Req.WorldHitLocation = Hit.ImpactPoint;
+		Req.HitNormal = Hit.ImpactNormal;
+	}
+
+	// Sent with any other edits from this frame as one batch
+	VPC->QueueBlockEditRequest(Req);
 }
 
@@ -0,0 +1,319 @@
+#include "VoxelFarTerrainActor.h"
+#include "Async/Async.h"
+#include "ChunkConfig.h"
+#include "VoxelGenerator.h"
+#include "VoxelMesher.h"
+
+AVoxelFarTerrainActor::AVoxelFarTerrainActor()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Root = CreateDefaultSubobject<USceneComponent>(TEXT("FarRoot"));
+    SetRootComponent(Root);
+
+    Completed = MakeShared<FResultQueue, ESPMode::ThreadSafe>();
+}
+
+void AVoxelFarTerrainActor::SetMaterial(UMaterialInterface* InMaterial)
+{
+    Material = InMaterial;
+    for (UProceduralMeshComponent* TileMesh : TileMeshes)
+    {
+        TileMesh->SetMaterial(0, Material);
+    }
+}
+
+int32 AVoxelFarTerrainActor::AcquireTileMesh()
+{
+    if (FreeSlots.Num() > 0)
+    {
+        return FreeSlots.Pop(EAllowShrinking::No);
+    }
+
+    UProceduralMeshComponent* TileMesh = NewObject<UProceduralMeshComponent>(this, NAME_None, RF_Transient);
+
+    // Render only
+    TileMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    TileMesh->SetGenerateOverlapEvents(false);
+    TileMesh->SetCanEverAffectNavigation(false);
+    TileMesh->SetVisibleInRayTracing(false);
+    TileMesh->SetCastShadow(false);
+
+    TileMesh->SetupAttachment(Root);
+    TileMesh->RegisterComponent();
+    return TileMeshes.Add(TileMesh);
+}
+
+int32 AVoxelFarTerrainActor::GetStrideForTileDistance(int32 TileDistance) const
+{
+    // Clipmap levels: level 0 covers FirstLevelTiles, each next level twice the distance at twice the stride
+    int32 Level = 0;
+    int32 Bound = FirstLevelTiles;
+    while (TileDistance > Bound && Level < MaxLevel)
+    {
+        ++Level;
+        Bound *= 2;
+    }
+
+    // Never coarser than one sample per tile edge
+    const int32 TileColumns = HorizonTileChunks * CHUNK_SIZE_X;
+    return FMath::Min(BaseStrideColumns << Level, TileColumns);
+}
+
+void AVoxelFarTerrainActor::UpdateCenter(const FIntPoint& CenterChunk, int32 InnerRadiusChunks, int32 OuterRadiusChunks)
+{
+    const int32 TC = HorizonTileChunks;
+    const FIntPoint CenterTile(FMath::FloorToInt((float)CenterChunk.X / TC), FMath::FloorToInt((float)CenterChunk.Y / TC));
+    const int32 TileRadius = FMath::DivideAndRoundUp(OuterRadiusChunks, TC) + 1;
+
+    // Desired tiles -> stride
+    TMap<FIntPoint, int32> Desired;
+    TMap<FIntPoint, int32> TileDist;
+    for (int32 ty = CenterTile.Y - TileRadius; ty <= CenterTile.Y + TileRadius; ++ty)
+    {
+        for (int32 tx = CenterTile.X - TileRadius; tx <= CenterTile.X + TileRadius; ++tx)
+        {
+            // Chunk range of the tile, relative to the center chunk
+            const int32 MinX = tx * TC - CenterChunk.X, MaxX = MinX + TC - 1;
+            const int32 MinY = ty * TC - CenterChunk.Y, MaxY = MinY + TC - 1;
+
+            // Fully covered by voxel chunks
+            if (MinX >= -InnerRadiusChunks && MaxX <= InnerRadiusChunks &&
+                MinY >= -InnerRadiusChunks && MaxY <= InnerRadiusChunks) continue;
+
+            // Nearest chunk of the tile past the outer radius
+            const int32 NearX = (MinX > 0) ? MinX : ((MaxX < 0) ? -MaxX : 0);
+            const int32 NearY = (MinY > 0) ? MinY : ((MaxY < 0) ? -MaxY : 0);
+            if (FMath::Max(NearX, NearY) > OuterRadiusChunks) continue;
+
+            // Nothing to show past the world edge
+            if (WorldLimitChunks > 0 &&
+                (tx * TC > WorldLimitChunks || tx * TC + TC - 1 < -WorldLimitChunks ||
+                 ty * TC > WorldLimitChunks || ty * TC + TC - 1 < -WorldLimitChunks)) continue;
+
+            const FIntPoint Tile(tx, ty);
+            const int32 Dist = FMath::Max(FMath::Abs(tx - CenterTile.X), FMath::Abs(ty - CenterTile.Y));
+            Desired.Add(Tile, GetStrideForTileDistance(Dist));
+            TileDist.Add(Tile, Dist);
+        }
+    }
+
+    // Drop tiles that left the ring (in-flight ones are dropped when their result lands)
+    for (auto It = Tiles.CreateIterator(); It; ++It)
+    {
+        FTileState& State = It.Value();
+        if (const int32* Stride = Desired.Find(It.Key()))
+        {
+            State.WantedStride = *Stride;
+            continue;
+        }
+
+        State.WantedStride = 0;
+        if (!State.bPending)
+        {
+            ReleaseTile(State);
+            It.RemoveCurrent();
+        }
+    }
+
+    // New tiles and level changes, nearest first
+    TArray<FIntPoint> Work;
+    for (const TPair<FIntPoint, int32>& Pair : Desired)
+    {
+        const FTileState* State = Tiles.Find(Pair.Key);
+        if (State && (State->bPending || State->Stride == Pair.Value)) continue;
+        Work.Add(Pair.Key);
+    }
+    Work.Sort([&TileDist](const FIntPoint& A, const FIntPoint& B) { return TileDist[A] < TileDist[B]; });
+
+    int32 Budget = MaxTileBuildsPerUpdate;
+    for (const FIntPoint& Tile : Work)
+    {
+        if (Budget-- <= 0) break;
+
+        FTileState& State = Tiles.FindOrAdd(Tile);
+        State.WantedStride = Desired[Tile];
+        State.bPending = true;
+        KickTileBuild(Tile, State.WantedStride);
+    }
+}
+
+void AVoxelFarTerrainActor::KickTileBuild(const FIntPoint& Tile, int32 Stride)
+{
+    TSharedPtr<FResultQueue, ESPMode::ThreadSafe> Queue = Completed;
+    const int32 Seed = WorldSeed;
+    const float BS = BlockSize;
+    const float Sink = SinkBlocks;
+    const int32 TileColumns = HorizonTileChunks * CHUNK_SIZE_X;
+
+    Async(EAsyncExecution::ThreadPool, [Queue, Tile, Stride, Seed, BS, Sink, TileColumns]()
+        {
+            TSharedPtr<FFarTerrainTileResult> R = MakeShared<FFarTerrainTileResult>();
+            R->Tile = Tile;
+            R->Stride = Stride;
+
+            // (N + 1)^2 shared grid vertices; column corners, so neighboring tiles meet exactly
+            const int32 N = FMath::Max(1, TileColumns / Stride);
+            const int32 NV = N + 1;
+            const int32 WX0 = Tile.X * TileColumns;
+            const int32 WZ0 = Tile.Y * TileColumns;
+
+            FVoxelGenerator Gen(Seed);
+            TArray<int32> Tops;
+            Gen.SampleColumnTopYGrid(WX0, WZ0, Stride, NV, NV, Tops);
+
+            const float Half = BS * 0.5f;
+            auto HeightAt = [&](int32 ix, int32 iz) -> float
+                {
+                    ix = FMath::Clamp(ix, 0, N);
+                    iz = FMath::Clamp(iz, 0, N);
+                    return static_cast<float>(Tops[ix + iz * NV]);
+                };
+            auto SurfaceZ = [&](float TopY) { return (TopY + 1.f - Sink) * BS - Half; };
+
+            // Same layering as GenerateBaseChunk; one surface block for the whole tile
+            FVector2D SurfaceUV;
+            FLinearColor SurfaceColor;
+            FVoxelMesher_Naive::GetSurfaceAttributes(FVoxelGenerator::GetSurfaceBlock(), SurfaceUV, SurfaceColor);
+
+            FProcMeshSection& Section = R->Section;
+            Section.ProcVertexBuffer.Reserve(NV * NV + 4 * N * 4);
+            Section.ProcIndexBuffer.Reserve(N * N * 6 + 4 * N * 6);
+
+            // Grid vertices: position, normal from central differences, surface block attributes
+            for (int32 iz = 0; iz < NV; ++iz)
+            {
+                for (int32 ix = 0; ix < NV; ++ix)
+                {
+                    const int32 WX = WX0 + ix * Stride;
+                    const int32 WZ = WZ0 + iz * Stride;
+                    const float H = HeightAt(ix, iz);
+
+                    const float DX = (HeightAt(ix + 1, iz) - HeightAt(ix - 1, iz)) / (2.f * Stride);
+                    const float DY = (HeightAt(ix, iz + 1) - HeightAt(ix, iz - 1)) / (2.f * Stride);
+                    const FVector Normal = FVector(-DX, -DY, 1.f).GetSafeNormal();
+
+                    FProcMeshVertex& V = Section.ProcVertexBuffer.Emplace_GetRef();
+                    // Voxel Z maps to world Y and voxel Y (vertical) maps to world Z.
+                    V.Position = FVector(WX * BS - Half, WZ * BS - Half, SurfaceZ(H));
+                    V.Normal = Normal;
+                    V.Tangent = FProcMeshTangent(FVector::CrossProduct(FVector::UpVector, Normal).GetSafeNormal(), false);
+                    V.Color = SurfaceColor.ToFColor(false);
+                    V.UV0 = SurfaceUV;
+                    Section.SectionLocalBox += V.Position;
+                }
+            }
+
+            // Same winding as the voxel top faces
+            for (int32 iz = 0; iz < N; ++iz)
+            {
+                for (int32 ix = 0; ix < N; ++ix)
+                {
+                    const uint32 V00 = ix + iz * NV;
+                    const uint32 V10 = V00 + 1;
+                    const uint32 V01 = V00 + NV;
+                    const uint32 V11 = V01 + 1;
+                    Section.ProcIndexBuffer.Append({ V00, V11, V10, V00, V01, V11 });
+                }
+            }
+
+            // Skirts on the four edges hide cracks against tiles at another stride (T-junctions).
+            // Walk each edge counter-clockwise seen from above, like the voxel side faces.
+            const float SkirtDepth = FMath::Max(8.f, 2.f * Stride) * BS;
+            auto AddSkirt = [&](int32 StartX, int32 StartZ, int32 StepX, int32 StepZ, const FVector& Outward)
+                {
+                    for (int32 i = 0; i < N; ++i)
+                    {
+                        const int32 PX = StartX + StepX * i, PZ = StartZ + StepZ * i;
+                        const int32 QX = PX + StepX, QZ = PZ + StepZ;
+
+                        // Copies: the buffer grows below
+                        const FProcMeshVertex TopP = Section.ProcVertexBuffer[PX + PZ * NV];
+                        const FProcMeshVertex TopQ = Section.ProcVertexBuffer[QX + QZ * NV];
+
+                        const uint32 Base = static_cast<uint32>(Section.ProcVertexBuffer.Num());
+                        const FVector Corners[4] =
+                        {
+                            TopP.Position - FVector(0, 0, SkirtDepth), TopQ.Position - FVector(0, 0, SkirtDepth),
+                            TopQ.Position, TopP.Position
+                        };
+                        const FColor Color = TopP.Color;
+                        const FVector2D UV = TopP.UV0;
+                        for (const FVector& C : Corners)
+                        {
+                            FProcMeshVertex& V = Section.ProcVertexBuffer.Emplace_GetRef();
+                            V.Position = C;
+                            V.Normal = Outward;
+                            V.Tangent = FProcMeshTangent(FVector::CrossProduct(FVector::UpVector, Outward), false);
+                            V.Color = Color;
+                            V.UV0 = UV;
+                            Section.SectionLocalBox += C;
+                        }
+                        Section.ProcIndexBuffer.Append({ Base + 0, Base + 2, Base + 1, Base + 0, Base + 3, Base + 2 });
+                    }
+                };
+            AddSkirt(0, 0, 1, 0, FVector(0, -1, 0)); // south, +X
+            AddSkirt(N, 0, 0, 1, FVector(1, 0, 0));  // east, +Y
+            AddSkirt(N, N, -1, 0, FVector(0, 1, 0)); // north, -X
+            AddSkirt(0, N, 0, -1, FVector(-1, 0, 0)); // west, -Y
+
+            Section.bEnableCollision = false;
+            Section.bSectionVisible = true;
+
+            Queue->Enqueue(R);
+        });
+}
+
+void AVoxelFarTerrainActor::DrainResults(int32 MaxItems)
+{
+    TSharedPtr<FFarTerrainTileResult> Res;
+    while (MaxItems-- > 0 && Completed->Dequeue(Res))
+    {
+        FTileState* State = Tiles.Find(Res->Tile);
+        if (!State) continue;
+        State->bPending = false;
+
+        // Left the ring while building
+        if (State->WantedStride == 0)
+        {
+            ReleaseTile(*State);
+            Tiles.Remove(Res->Tile);
+            continue;
+        }
+
+        if (State->Slot == INDEX_NONE)
+        {
+            State->Slot = AcquireTileMesh();
+        }
+
+        // Same move-into-slot upload as chunk actors; only this tile's component is refreshed
+        UProceduralMeshComponent* TileMesh = TileMeshes[State->Slot];
+        if (FProcMeshSection* Slot = TileMesh->GetProcMeshSection(0))
+        {
+            *Slot = MoveTemp(Res->Section);
+            TileMesh->SetProcMeshSection(0, *Slot);
+        }
+        else
+        {
+            TileMesh->SetProcMeshSection(0, Res->Section);
+        }
+        if (Material)
+        {
+            TileMesh->SetMaterial(0, Material);
+        }
+
+        // A stale stride still beats a hole; UpdateCenter re-queues it
+        State->Stride = Res->Stride;
+    }
+}
+
+void AVoxelFarTerrainActor::ReleaseTile(FTileState& State)
+{
+    if (State.Slot != INDEX_NONE)
+    {
+        TileMeshes[State.Slot]->ClearMeshSection(0);
+        FreeSlots.Add(State.Slot);
+        State.Slot = INDEX_NONE;
+    }
+    State.Stride = 0;
+}
@@ -4,13 +4,118 @@
 #include "Math/UnrealMathUtility.h"
 #include "ProceduralMeshComponent.h" // for FProcMeshTangent
 
+using VoxelKernel::FaceCorners;
+
+static_assert(VoxelKernel::BlockId::Air == static_cast<uint8>(EBlockId::Air), "Kernel air id must match EBlockId");
+
+static const FVector GFaceNormals[6] =
+{
+    FVector(1, 0, 0), FVector(-1, 0, 0),
+    FVector(0, 1, 0), FVector(0, -1, 0),
+    FVector(0, 0, 1), FVector(0, 0, -1),
+};
+
+// Kernel inputs for one build: a dense view of the chunk (deltas applied) and the neighbor slabs
+struct FVoxelMesherInput
+{
+    TArray<uint8> Scratch;
+    VoxelKernel::FChunkView Chunk;
+    VoxelKernel::FBorderView BorderView;
+    const VoxelKernel::FBorderView* Borders = nullptr;
+
+    FVoxelMesherInput(const FVoxelChunkData& InChunk, const FVoxelChunkBorders* InBorders)
+    {
+        // Empty chunks never read their blocks, so skip flattening the deltas
+        Chunk.Extents = &InChunk.Extents;
+        if (!InChunk.IsEmpty())
+        {
+            Chunk = InChunk.MakeView(Scratch);
+        }
+        if (InBorders)
+        {
+            BorderView = InBorders->MakeView();
+            Borders = &BorderView;
+        }
+    }
+};
+
+template <typename CellFaceFunc>
+void FVoxelMesher_Naive::ForEachVisibleCellFace(const FVoxelChunkData& Chunk, const FVoxelChunkBorders* Borders, int32 SectionIndex, CellFaceFunc&& EmitCellFace)
+{
+    const FVoxelMesherInput Input(Chunk, Borders);
+    VoxelKernel::ForEachVisibleCellFace(Input.Chunk, Input.Borders, SectionIndex, [&EmitCellFace](int32 X, int32 Y, int32 Z, EVoxelFace Face, uint8 Id)
+        {
+            EmitCellFace(X, Y, Z, Face, static_cast<EBlockId>(Id));
+        });
+}
+
+template <typename FaceFunc>
+void FVoxelMesher_Naive::ForEachVisibleFace(const FVoxelChunkData& Chunk, float BlockSize, const FVoxelChunkBorders* Borders, int32 SectionIndex, FaceFunc&& EmitFace)
+{
+    const float Half = BlockSize * 0.5f;
+
+    ForEachVisibleCellFace(Chunk, Borders, SectionIndex, [&](int32 X, int32 Y, int32 Z, EVoxelFace Face, EBlockId Id)
+        {
+            // Voxel Z maps to world Y and voxel Y (vertical) maps to world Z.
+            const FVector Min(
+                static_cast<float>(X) * BlockSize - Half,
+                static_cast<float>(Z) * BlockSize - Half,
+                static_cast<float>(Y) * BlockSize - Half);
+
+            const int32 F = static_cast<int32>(Face);
+            const uint8 Slot = GetAtlasSlotForBlock(Id);
+            FVector Corners[4];
+            FVector2D UVs[4];
+            for (int32 c = 0; c < 4; ++c)
+            {
+                Corners[c] = Min + FVector(FaceCorners[F][c][0], FaceCorners[F][c][1], FaceCorners[F][c][2]) * BlockSize;
+                UVs[c] = GetAtlasCornerUV(Slot, Face, c);
+            }
+
+            EmitFace(Corners[0], Corners[1], Corners[2], Corners[3], GFaceNormals[F], UVs, GetBlockColor(Id));
+        });
+}
+
+// Append one quad (4 vertices, 2 triangles) in the procedural section layout shared by all section builders.
+static void AppendSectionQuad(FProcMeshSection& OutSection, const FVector (&Corners)[4],
+    const FVector& Normal, const FVector2D (&UVs)[4], const FLinearColor& Color)
+{
+    const uint32 Base = static_cast<uint32>(OutSection.ProcVertexBuffer.Num());
+
+    // Same conversions CreateMeshSection_LinearColor would do on the game thread.
+    const FVector TangentDir = FVector::CrossProduct(FVector::UpVector, Normal).GetSafeNormal();
+    const FProcMeshTangent Tangent(TangentDir, false);
+    const FColor VertexColor = Color.ToFColor(false);
+
+    for (int32 i = 0; i < 4; ++i)
+    {
+        FProcMeshVertex& Vtx = OutSection.ProcVertexBuffer.Emplace_GetRef();
+        Vtx.Position = Corners[i];
+        Vtx.Normal = Normal;
+        Vtx.Tangent = Tangent;
+        Vtx.Color = VertexColor;
+        Vtx.UV0 = UVs[i];
+        OutSection.SectionLocalBox += Vtx.Position;
+    }
+
+    // Flipped winding order for outward normals
+    OutSection.ProcIndexBuffer.Add(Base + 0);
+    OutSection.ProcIndexBuffer.Add(Base + 2);
+    OutSection.ProcIndexBuffer.Add(Base + 1);
+    OutSection.ProcIndexBuffer.Add(Base + 0);
+    OutSection.ProcIndexBuffer.Add(Base + 3);
+    OutSection.ProcIndexBuffer.Add(Base + 2);
+}
+
 void FVoxelMesher_Naive::BuildMesh(const FVoxelChunkData& Chunk, float BlockSize,
     TArray<FVector>& OutVertices,
     TArray<int32>& OutTriangles,
     TArray<FVector>& OutNormals,
     TArray<FVector2D>& OutUVs,
     TArray<FLinearColor>& OutColors,
-    TArray<FProcMeshTangent>& OutTangents)
+    TArray<FProcMeshTangent>& OutTangents,
+    const FVoxelChunkBorders* Borders,
+    int32 SectionIndex)
 {
     OutVertices.Reset();
     OutTriangles.Reset();
@@ -19,117 +124,286 @@ void FVoxelMesher_Naive::BuildMesh(const FVoxelChunkData& Chunk, float BlockSize
     OutColors.Reset();
     OutTangents.Reset();
 
-    const float Half = BlockSize * 0.5f;
+    ForEachVisibleFace(Chunk, BlockSize, Borders, SectionIndex,
+        [&](const FVector& A, const FVector& B, const FVector& C, const FVector& D,
+            const FVector& Normal, const FVector2D (&UVs)[4], const FLinearColor& Color)
+        {
+            const int32 Base = OutVertices.Num();
+
+            OutVertices.Add(A); // 0
+            OutVertices.Add(B); // 1
+            OutVertices.Add(C); // 2
+            OutVertices.Add(D); // 3
+
+            // Flipped winding order for outward normals
+            OutTriangles.Add(Base + 0);
+            OutTriangles.Add(Base + 2);
+            OutTriangles.Add(Base + 1);
+            OutTriangles.Add(Base + 0);
+            OutTriangles.Add(Base + 3);
+            OutTriangles.Add(Base + 2);
+
+            OutNormals.Add(Normal);
+            OutNormals.Add(Normal);
+            OutNormals.Add(Normal);
+            OutNormals.Add(Normal);
+
+            OutUVs.Add(UVs[0]);
+            OutUVs.Add(UVs[1]);
+            OutUVs.Add(UVs[2]);
+            OutUVs.Add(UVs[3]);
 
-    for (int32 X = 0; X < CHUNK_SIZE_X; ++X)
+            OutColors.Add(Color);
+            OutColors.Add(Color);
+            OutColors.Add(Color);
+            OutColors.Add(Color);
+
+            const FVector TangentDir = FVector::CrossProduct(FVector::UpVector, Normal).GetSafeNormal();
+            const FProcMeshTangent Tangent(TangentDir, false);
+            OutTangents.Add(Tangent);
+            OutTangents.Add(Tangent);
+            OutTangents.Add(Tangent);
+            OutTangents.Add(Tangent);
+        });
+}
+
+void FVoxelMesher_Naive::BuildMeshSection(const FVoxelChunkData& Chunk, float BlockSize, FProcMeshSection& OutSection,
+    const FVoxelChunkBorders* Borders, int32 SectionIndex)
+{
+    OutSection.Reset();
+
+    ForEachVisibleFace(Chunk, BlockSize, Borders, SectionIndex,
+        [&](const FVector& A, const FVector& B, const FVector& C, const FVector& D,
+            const FVector& Normal, const FVector2D (&UVs)[4], const FLinearColor& Color)
+        {
+            const FVector Corners[4] = { A, B, C, D };
+            AppendSectionQuad(OutSection, Corners, Normal, UVs, Color);
+        });
+
+    // Render only; collision comes from BuildCollisionSection
+    OutSection.bEnableCollision = false;
+    OutSection.bSectionVisible = true;
+}
+
+// Collision-only quad: positions (plus the normal, for debug views); no UVs, colors or tangents.
+static void AppendCollisionQuad(FProcMeshSection& OutSection, const FVector (&Corners)[4], const FVector& Normal)
+{
+    const uint32 Base = static_cast<uint32>(OutSection.ProcVertexBuffer.Num());
+    for (int32 i = 0; i < 4; ++i)
     {
-        for (int32 Z = 0; Z < CHUNK_SIZE_Z; ++Z)
+        FProcMeshVertex& Vtx = OutSection.ProcVertexBuffer.Emplace_GetRef();
+        Vtx.Position = Corners[i];
+        Vtx.Normal = Normal;
+        OutSection.SectionLocalBox += Vtx.Position;
+    }
+
+    // Same winding as the render quads
+    OutSection.ProcIndexBuffer.Add(Base + 0);
+    OutSection.ProcIndexBuffer.Add(Base + 2);
+    OutSection.ProcIndexBuffer.Add(Base + 1);
+    OutSection.ProcIndexBuffer.Add(Base + 0);
+    OutSection.ProcIndexBuffer.Add(Base + 3);
+    OutSection.ProcIndexBuffer.Add(Base + 2);
+}
+
+void FVoxelMesher_Naive::BuildCollisionSection(const FVoxelChunkData& Chunk, float BlockSize, FProcMeshSection& OutSection,
+    const FVoxelChunkBorders* Borders, int32 SectionIndex)
+{
+    OutSection.Reset();
+    OutSection.bEnableCollision = true;
+    OutSection.bSectionVisible = false;
+
+    const float Half = BlockSize * 0.5f;
+    const FVoxelMesherInput Input(Chunk, Borders);
+    VoxelKernel::ForEachCollisionRect(Input.Chunk, Input.Borders, SectionIndex, [&](EVoxelFace Face, const int32 (&Lo)[3], const int32 (&Hi)[3])
         {
-            for (int32 Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+            // Each face corner picks the low or high side of the merged cell range per axis
+            const int32 F = static_cast<int32>(Face);
+            FVector Corners[4];
+            for (int32 c = 0; c < 4; ++c)
             {
-                EBlockId Id = Chunk.GetBlockAt(X, Y, Z);
-                if (Id == EBlockId::Air) continue;
-
-                const float WorldX = static_cast<float>(X) * BlockSize;
-                const float WorldY = static_cast<float>(Z) * BlockSize;
-                const float WorldZ = static_cast<float>(Y) * BlockSize;
-
-                const FVector Min(WorldX - Half, WorldY - Half, WorldZ - Half);
-                const FVector Max(WorldX + Half, WorldY + Half, WorldZ + Half);
-
-                const FVector
-                    B00(Min.X, Min.Y, Min.Z), B10(Max.X, Min.Y, Min.Z),
-                    B11(Max.X, Max.Y, Min.Z), B01(Min.X, Max.Y, Min.Z),
-                    T00(Min.X, Min.Y, Max.Z), T10(Max.X, Min.Y, Max.Z),
-                    T11(Max.X, Max.Y, Max.Z), T01(Min.X, Max.Y, Max.Z);
-
-                FVector2D UV0, Tile;
-                GetAtlasUVForBlock(Id, UV0, Tile);
-
-                FLinearColor Color = FLinearColor::White;
-                switch (Id)
-                {
-                case EBlockId::Grass: Color = FLinearColor(0.1f, 0.8f, 0.1f); break;
-                case EBlockId::Dirt:  Color = FLinearColor(0.45f, 0.28f, 0.13f); break;
-                case EBlockId::Stone: Color = FLinearColor(0.5f, 0.5f, 0.5f); break;
-                default: break;
-                }
-
-                auto PushFace = [&](const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& Normal, bool bFlipTopUVs = false)
-                    {
-                        const int32 Base = OutVertices.Num();
-
-                        OutVertices.Add(A); // 0
-                        OutVertices.Add(B); // 1
-                        OutVertices.Add(C); // 2
-                        OutVertices.Add(D); // 3
-
-                        // Flipped winding order for outward normals
-                        OutTriangles.Add(Base + 0);
-                        OutTriangles.Add(Base + 2);
-                        OutTriangles.Add(Base + 1);
-                        OutTriangles.Add(Base + 0);
-                        OutTriangles.Add(Base + 3);
-                        OutTriangles.Add(Base + 2);
-
-                        OutNormals.Add(Normal);
-                        OutNormals.Add(Normal);
-                        OutNormals.Add(Normal);
-                        OutNormals.Add(Normal);
-
-                        // UVs
-                        if (!bFlipTopUVs)
-                        {
-                            const FVector2D U00(UV0.X, UV0.Y);
-                            const FVector2D U10(UV0.X + Tile.X, UV0.Y);
-                            const FVector2D U11(UV0.X + Tile.X, UV0.Y + Tile.Y);
-                            const FVector2D U01(UV0.X, UV0.Y + Tile.Y);
-                            OutUVs.Add(U00);
-                            OutUVs.Add(U10);
-                            OutUVs.Add(U11);
-                            OutUVs.Add(U01);
-                        }
-                        else
-                        {
-                            // ? Corrected orientation for grass top
-                            const FVector2D U00(UV0.X, UV0.Y + Tile.Y);
-                            const FVector2D U10(UV0.X + Tile.X, UV0.Y + Tile.Y);
-                            const FVector2D U11(UV0.X + Tile.X, UV0.Y);
-                            const FVector2D U01(UV0.X, UV0.Y);
-                            OutUVs.Add(U00);
-                            OutUVs.Add(U10);
-                            OutUVs.Add(U11);
-                            OutUVs.Add(U01);
-                        }
-
-                        OutColors.Add(Color);
-                        OutColors.Add(Color);
-                        OutColors.Add(Color);
-                        OutColors.Add(Color);
-
-                        const FVector TangentDir = FVector::CrossProduct(FVector::UpVector, Normal).GetSafeNormal();
-                        const FProcMeshTangent Tangent(TangentDir, false);
-                        OutTangents.Add(Tangent);
-                        OutTangents.Add(Tangent);
-                        OutTangents.Add(Tangent);
-                        OutTangents.Add(Tangent);
-                    };
-
-                auto IsAir = [&](int32 NX, int32 NY, int32 NZ)
-                    {
-                        if (NX < 0 || NX >= CHUNK_SIZE_X ||
-                            NY < 0 || NY >= CHUNK_SIZE_Y ||
-                            NZ < 0 || NZ >= CHUNK_SIZE_Z) return true;
-                        return Chunk.GetBlockAt(NX, NY, NZ) == EBlockId::Air;
-                    };
-
-                if (IsAir(X + 1, Y, Z)) PushFace(B10, B11, T11, T10, FVector(1, 0, 0));    // +X
-                if (IsAir(X - 1, Y, Z)) PushFace(B01, B00, T00, T01, FVector(-1, 0, 0));   // -X
-                if (IsAir(X, Y, Z + 1)) PushFace(B11, B01, T01, T11, FVector(0, 1, 0));    // +Y (north)
-                if (IsAir(X, Y, Z - 1)) PushFace(B00, B10, T10, T00, FVector(0, -1, 0));   // -Y (south)
-                if (IsAir(X, Y + 1, Z)) PushFace(T00, T10, T11, T01, FVector(0, 0, 1), true); // +Z (top, flip UVs)
-                if (IsAir(X, Y - 1, Z)) PushFace(B01, B11, B10, B00, FVector(0, 0, -1));   // -Z (bottom)
+                // FaceCorners are world-axis offsets: voxel Z maps to world Y, voxel Y to world Z.
+                const int32 CX = FaceCorners[F][c][0] ? Hi[0] : Lo[0];
+                const int32 CZ = FaceCorners[F][c][1] ? Hi[2] : Lo[2];
+                const int32 CY = FaceCorners[F][c][2] ? Hi[1] : Lo[1];
+                Corners[c] = FVector(CX * BlockSize - Half, CZ * BlockSize - Half, CY * BlockSize - Half);
             }
+            AppendCollisionQuad(OutSection, Corners, GFaceNormals[F]);
+        });
+}
+
+void FVoxelMesher_Naive::BuildPackedMesh(const FVoxelChunkData& Chunk, TArray<FVoxelPackedVertex>& OutVertices, FBox& OutVoxelBounds,
+    const FVoxelChunkBorders* Borders, int32 SectionIndex)
+{
+    OutVertices.Reset();
+    OutVoxelBounds = FBox(ForceInit);
+
+    ForEachVisibleCellFace(Chunk, Borders, SectionIndex, [&](int32 X, int32 Y, int32 Z, EVoxelFace Face, EBlockId Id)
+        {
+            const int32 F = static_cast<int32>(Face);
+            const uint8 Tile = GetAtlasSlotForBlock(Id);
+            const uint8 ColorIndex = static_cast<uint8>(Id);
+
+            for (int32 c = 0; c < 4; ++c)
+            {
+                // Packed corners live in voxel space: world-axis offsets (x, y, z) -> voxel (X, Z, Y).
+                const int32 CX = X + FaceCorners[F][c][0];
+                const int32 CY = Y + FaceCorners[F][c][2];
+                const int32 CZ = Z + FaceCorners[F][c][1];
+                OutVertices.Add(FVoxelPackedVertex::Pack(CX, CY, CZ, Face, c, Tile, ColorIndex));
+                OutVoxelBounds += FVector(CX, CZ, CY);
+            }
+        });
+}
+
+template <typename QuadFunc>
+void FVoxelMesher_Naive::ForEachLODQuad(const FVoxelChunkData& Chunk, int32 LOD, QuadFunc&& EmitQuad)
+{
+    const FVoxelMesherInput Input(Chunk, nullptr);
+    VoxelKernel::ForEachLODQuad(Input.Chunk, LOD, [&EmitQuad](const int32 (&Corners)[4][3], EVoxelFace Face, uint8 Id)
+        {
+            const FIntVector Points[4] =
+            {
+                FIntVector(Corners[0][0], Corners[0][1], Corners[0][2]),
+                FIntVector(Corners[1][0], Corners[1][1], Corners[1][2]),
+                FIntVector(Corners[2][0], Corners[2][1], Corners[2][2]),
+                FIntVector(Corners[3][0], Corners[3][1], Corners[3][2]),
+            };
+            EmitQuad(Points, Face, static_cast<EBlockId>(Id));
+        });
+}
+
+void FVoxelMesher_Naive::BuildLODMeshSection(const FVoxelChunkData& Chunk, float BlockSize, int32 LOD, FProcMeshSection& OutSection)
+{
+    OutSection.Reset();
+
+    const float Half = BlockSize * 0.5f;
+    ForEachLODQuad(Chunk, LOD, [&](const FIntVector (&Corners)[4], EVoxelFace Face, EBlockId Id)
+        {
+            const int32 F = static_cast<int32>(Face);
+            const uint8 Slot = GetAtlasSlotForBlock(Id);
+
+            FVector Positions[4];
+            FVector2D UVs[4];
+            for (int32 c = 0; c < 4; ++c)
+            {
+                // Voxel Z maps to world Y and voxel Y (vertical) maps to world Z.
+                Positions[c] = FVector(
+                    Corners[c].X * BlockSize - Half,
+                    Corners[c].Z * BlockSize - Half,
+                    Corners[c].Y * BlockSize - Half);
+                UVs[c] = GetAtlasCornerUV(Slot, Face, c);
+            }
+            AppendSectionQuad(OutSection, Positions, GFaceNormals[F], UVs, GetBlockColor(Id));
+        });
+
+    OutSection.bEnableCollision = false;
+    OutSection.bSectionVisible = true;
+}
+
+void FVoxelMesher_Naive::BuildLODPackedMesh(const FVoxelChunkData& Chunk, int32 LOD, TArray<FVoxelPackedVertex>& OutVertices, FBox& OutVoxelBounds)
+{
+    OutVertices.Reset();
+    OutVoxelBounds = FBox(ForceInit);
+
+    ForEachLODQuad(Chunk, LOD, [&](const FIntVector (&Corners)[4], EVoxelFace Face, EBlockId Id)
+        {
+            const uint8 Tile = GetAtlasSlotForBlock(Id);
+            for (int32 c = 0; c < 4; ++c)
+            {
+                OutVertices.Add(FVoxelPackedVertex::Pack(Corners[c].X, Corners[c].Y, Corners[c].Z, Face, c, Tile, static_cast<uint8>(Id)));
+                OutVoxelBounds += FVector(Corners[c].X, Corners[c].Z, Corners[c].Y);
+            }
+        });
+}
+
+uint32 FVoxelMesher_Naive::GetSectionMaskForCellY(int32 Y)
+{
+    return VoxelKernel::GetSectionMaskForCellY(Y);
+}
+
+void FVoxelMesher_Naive::DecodePackedVertex(const FVoxelPackedVertex& Packed, float BlockSize,
+    FVector3f& OutPosition, FVector3f& OutNormal, FVector3f& OutTangent, FVector2f& OutUV, FColor& OutColor)
+{
+    const float Half = BlockSize * 0.5f;
+    const EVoxelFace Face = Packed.GetFace();
+    const int32 F = static_cast<int32>(Face);
+
+    OutPosition = FVector3f(
+        static_cast<float>(Packed.GetX()) * BlockSize - Half,
+        static_cast<float>(Packed.GetZ()) * BlockSize - Half,
+        static_cast<float>(Packed.GetY()) * BlockSize - Half);
+
+    OutNormal = FVector3f(GFaceNormals[F]);
+
+    // Same tangent the section path uses; top/bottom faces fall back to +X instead of a zero vector.
+    const FVector TangentDir = FVector::CrossProduct(FVector::UpVector, GFaceNormals[F]).GetSafeNormal();
+    OutTangent = TangentDir.IsNearlyZero() ? FVector3f(1.f, 0.f, 0.f) : FVector3f(TangentDir);
+
+    OutUV = FVector2f(GetAtlasCornerUV(Packed.GetTile(), Face, Packed.GetCorner()));
+    OutColor = GetBlockColor(static_cast<EBlockId>(Packed.GetColorIndex())).ToFColor(false);
+}
+
+// ------------------------ FVoxelChunkBorders ------------------------
+
+FChunkKey FVoxelChunkBorders::GetNeighborKey(const FChunkKey& Key, int32 Side)
+{
+    switch (Side)
+    {
+    case PosX: return FChunkKey(Key.X + 1, Key.Z);
+    case NegX: return FChunkKey(Key.X - 1, Key.Z);
+    case PosZ: return FChunkKey(Key.X, Key.Z + 1);
+    default:   return FChunkKey(Key.X, Key.Z - 1);
+    }
+}
+
+uint8 FVoxelChunkBorders::GetAvailableMask() const
+{
+    uint8 Mask = 0;
+    for (int32 Side = 0; Side < NumSides; ++Side)
+    {
+        if (HasSide(Side)) Mask |= (1 << Side);
+    }
+    return Mask;
+}
+
+void FVoxelChunkBorders::CaptureSide(int32 Side, const FVoxelChunkData& Neighbor)
+{
+    if (Neighbor.Blocks.Num() != CHUNK_VOLUME) return;
+
+    // The neighbor's layer facing us: its X=0 layer is our +X side, and so on.
+    const bool bXSide = Side < PosZ;
+    int32 Fixed = 0;
+    switch (Side)
+    {
+    case PosX: Fixed = 0; break;
+    case NegX: Fixed = CHUNK_SIZE_X - 1; break;
+    case PosZ: Fixed = 0; break;
+    default:   Fixed = CHUNK_SIZE_Z - 1; break;
+    }
+
+    const int32 Along = AlongSize(Side);
+    TArray<uint8>& Slab = Slabs[Side];
+    Slab.SetNumUninitialized(Along * CHUNK_SIZE_Y);
+
+    // Base layer straight from the block array...
+    for (int32 Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+    {
+        for (int32 A = 0; A < Along; ++A)
+        {
+            const int32 Index = bXSide ? IndexFromXYZ(Fixed, Y, A) : IndexFromXYZ(A, Y, Fixed);
+            Slab[A + Y * Along] = Neighbor.Blocks[Index];
+        }
+    }
+
+    // ...then overlay the deltas that land on it (usually few; avoids a map lookup per cell).
+    for (const TPair<int32, uint16>& P : Neighbor.ModifiedBlocks)
+    {
+        int32 X = 0, Y = 0, Z = 0;
+        XYZFromIndex(P.Key, X, Y, Z);
+        if (bXSide ? (X == Fixed) : (Z == Fixed))
+        {
+            Slab[(bXSide ? Z : X) + Y * Along] = static_cast<uint8>(P.Value);
         }
     }
 }
@@ -172,13 +446,12 @@ bool FVoxelMesher_Naive::IsAirNeighbor(const FVoxelChunkData& Chunk, int32 X, in
 // Current atlas: 1 row x 4 columns: [0]=Grass, [1]=Dirt, [2]=Stone, [3]=White/Blank
 void FVoxelMesher_Naive::GetAtlasUVForBlock(EBlockId Id, FVector2D& OutUV0, FVector2D& OutTileSize)
 {
-    const float TileW = 1.0f / 4.0f; // 4 columns
-    const float TileH = 1.0f / 4.0f; // 4 rows
-
-    // Small padding to reduce bleeding when mips/filters kick in
-    const float PadU = TileW * 0.03f;
-    const float PadV = TileH * 0.03f;
+    GetAtlasUVForSlot(GetAtlasSlotForBlock(Id), OutUV0, OutTileSize);
+}
 
+// Atlas slot = slotY * 4 + slotX on the 4x4 grid.
+uint8 FVoxelMesher_Naive::GetAtlasSlotForBlock(EBlockId Id)
+{
     int32 slotX = 3; // default to a free/blank tile
     int32 slotY = 3;
 
@@ -203,6 +476,58 @@ void FVoxelMesher_Naive::GetAtlasUVForBlock(EBlockId Id, FVector2D& OutUV0, FVec
     default:               slotX = 3; slotY = 3; break; // free tile
     }
 
+    return static_cast<uint8>(slotY * 4 + slotX);
+}
+
+void FVoxelMesher_Naive::GetAtlasUVForSlot(uint8 Slot, FVector2D& OutUV0, FVector2D& OutTileSize)
+{
+    const float TileW = 1.0f / 4.0f; // 4 columns
+    const float TileH = 1.0f / 4.0f; // 4 rows
+
+    // Small padding to reduce bleeding when mips/filters kick in
+    const float PadU = TileW * 0.03f;
+    const float PadV = TileH * 0.03f;
+
+    const int32 slotX = Slot % 4;
+    const int32 slotY = (Slot / 4) % 4;
+
     OutUV0 = FVector2D(slotX * TileW + PadU, slotY * TileH + PadV);
     OutTileSize = FVector2D(TileW - 2.0f * PadU, TileH - 2.0f * PadV);
 }
+
+FVector2D FVoxelMesher_Naive::GetAtlasCornerUV(uint8 Slot, EVoxelFace Face, int32 Corner)
+{
+    FVector2D UV0, Tile;
+    GetAtlasUVForSlot(Slot, UV0, Tile);
+
+    // Corner order 0..3 walks (u0,v0) (u1,v0) (u1,v1) (u0,v1)
+    const bool bU1 = (Corner == 1 || Corner == 2);
+    bool bV1 = (Corner == 2 || Corner == 3);
+
+    // ? Corrected orientation for grass top
+    if (Face == EVoxelFace::PosZ)
+    {
+        bV1 = !bV1;
+    }
+
+    return FVector2D(UV0.X + (bU1 ? Tile.X : 0.0f), UV0.Y + (bV1 ? Tile.Y : 0.0f));
+}
+
+void FVoxelMesher_Naive::GetSurfaceAttributes(EBlockId Id, FVector2D& OutUV, FLinearColor& OutColor)
+{
+    FVector2D UV0, TileSize;
+    GetAtlasUVForSlot(GetAtlasSlotForBlock(Id), UV0, TileSize);
+    OutUV = UV0 + TileSize * 0.5;
+    OutColor = GetBlockColor(Id);
+}
+
+FLinearColor FVoxelMesher_Naive::GetBlockColor(EBlockId Id)
+{
+    switch (Id)
+    {
+    case EBlockId::Grass: return FLinearColor(0.1f, 0.8f, 0.1f);
+    case EBlockId::Dirt:  return FLinearColor(0.45f, 0.28f, 0.13f);
+    case EBlockId::Stone: return FLinearColor(0.5f, 0.5f, 0.5f);
+    default: return FLinearColor::White;
+    }
+}
@@ -1,177 +1,622 @@
 ﻿#include "VoxelPlayerController.h"            // MUST be first
 #include "VoxelWorldManager.h"
-#include "Kismet/GameplayStatics.h"
 #include "ChunkConfig.h"
 #include "Engine/World.h"
+#include "Algo/Reverse.h"
+#include "VoxelDeltaCodec.h"
+#include "VoxelWorldSubsystem.h"
+#include "VoxelStats.h"
 
 // -----------------------------------------------------------------------------
 // Helper: find the authoritative world manager on the server
 // -----------------------------------------------------------------------------
 AVoxelWorldManager* AVoxelPlayerController::GetAuthoritativeWorldManager() const
 {
-    UWorld* World = GetWorld();
-    if (!World) return nullptr;
-
-    TArray<AActor*> Found;
-    UGameplayStatics::GetAllActorsOfClass(World, AVoxelWorldManager::StaticClass(), Found);
-
-    for (AActor* A : Found)
-    {
-        if (AVoxelWorldManager* Mgr = Cast<AVoxelWorldManager>(A))
-        {
-            if (Mgr->HasAuthority() && !Mgr->bClientVisualInstance)
-            {
-                return Mgr;
-            }
-        }
-    }
-    return nullptr;
+    const UVoxelWorldSubsystem* Registry = UVoxelWorldSubsystem::Get(GetWorld());
+    return Registry ? Registry->GetAuthoritativeManager() : nullptr;
 }
 
 // -----------------------------------------------------------------------------
-// Client → Server: request an edit (place/remove) [single-op path]
+// Server: validate a request and resolve the cell it edits
 // -----------------------------------------------------------------------------
-void AVoxelPlayerController::Server_RequestBlockEdit_Implementation(const FBlockEditRequest& Req)
+bool AVoxelPlayerController::ResolveEditRequest_Server(AVoxelWorldManager& ServerMgr, const FBlockEditRequest& Req, FChunkKey& OutKey, int32& OutLocalIndex) const
 {
     APawn* P = GetPawn();
-    if (!P) return;
+    if (!P) return false;
 
     // Basic reach/sanity
     const float MaxReach = FMath::Clamp(Req.ClaimedReach, 150.f, 800.f);
-    if (FVector::Dist(P->GetActorLocation(), Req.WorldHitLocation) > MaxReach)
-        return;
+    const FVector PawnLoc = P->GetActorLocation();
 
-    AVoxelWorldManager* ServerMgr = GetAuthoritativeWorldManager();
-    if (!ServerMgr) return;
-
-    // World hit → (chunk, localIndex). For placement, step into the adjacent cell along normal.
-    FChunkKey Key; int32 LocalIndex = 0; FString Fail;
     const bool bForPlacement = (Req.Action == EVoxelEditAction::Place);
-    if (!ServerMgr->ResolveVoxelFromHit(Req.WorldHitLocation, Req.HitNormal, bForPlacement, Key, LocalIndex, Fail))
-        return;
+
+    // Ray requests only: without one the server would have to trust the client's hit point
+    if (Req.TraceDirection.IsNearlyZero())
+        return false;
+
+    // Re-run the client's aim on authoritative data from the client's own ray origin (its camera), so both sides
+    // resolve the same cell. The origin is trusted only near the pawn's eyes and in their line of sight: one past
+    // a wall would edit through it.
+    FVector EyeLoc;
+    FRotator EyeRot;
+    P->GetActorEyesViewPoint(EyeLoc, EyeRot);
+    const FVector EyeToStart = Req.TraceStart - EyeLoc;
+    const float StartDist = EyeToStart.Size();
+    if (StartDist > EditTraceStartTolerance)
+        return false;
+
+    FVoxelRayHit Hit;
+    if (StartDist > KINDA_SMALL_NUMBER && ServerMgr.VoxelRaycast(EyeLoc, EyeToStart / StartDist, StartDist, Hit))
+        return false;
+
+    if (!ServerMgr.VoxelRaycast(Req.TraceStart, Req.TraceDirection.GetSafeNormal(), MaxReach, Hit))
+        return false;
+    if (FVector::Dist(PawnLoc, Hit.WorldHitLocation) > MaxReach)
+        return false;
+
+    // Placement goes into the empty cell in front of the hit face
+    if (bForPlacement)
+    {
+        if (!Hit.bHasPreviousCell) return false;
+        OutKey = FChunkKey(Hit.PreviousChunkXZ.X, Hit.PreviousChunkXZ.Y);
+        OutLocalIndex = Hit.PreviousLocalIndex;
+    }
+    else
+    {
+        OutKey = FChunkKey(Hit.ChunkXZ.X, Hit.ChunkXZ.Y);
+        OutLocalIndex = Hit.LocalIndex;
+    }
+    return true;
+}
+
+EVoxelEditOutcome AVoxelPlayerController::ApplyAdmittedEdit_Server(AVoxelWorldManager& ServerMgr, const FBlockEditRequest& Req, FVoxelEditedCells& CellsThisTick)
+{
+    FChunkKey Key; int32 LocalIndex = 0;
+    if (!ResolveEditRequest_Server(ServerMgr, Req, Key, LocalIndex))
+    {
+        AckEditPrediction_Server(Req.PredictionId, 0);
+        return EVoxelEditOutcome::Invalid;
+    }
+
+    // The same cell already set to the same id this tick: a repeat, skip it. A different id is applied (last write wins).
+    const int32 NewId = (Req.Action == EVoxelEditAction::Place) ? Req.NewBlockId : 0;
+    const uint8 CellId = (uint8)FMath::Clamp(NewId, 0, (int32)UINT8_MAX);
+    const FVoxelEditedCell Cell(Key.X, Key.Z, LocalIndex);
+    const uint8* AppliedId = CellsThisTick.Find(Cell);
+    if (AppliedId && *AppliedId == CellId)
+    {
+        AckEditPrediction_Server(Req.PredictionId, 0);
+        return EVoxelEditOutcome::Duplicate;
+    }
 
     // Apply on server (authoritative).
     TArray<FChunkKey> Dummy;
-    const int32 NewId = (Req.Action == EVoxelEditAction::Place) ? Req.NewBlockId : 0;
     FString Reason;
-    if (!ServerMgr->ApplyBlockEdit_Server(Key, LocalIndex, NewId, Dummy, Reason))
-        return;
+    int32 Seq = 0;
+    const bool bApplied = ServerMgr.ApplyBlockEdit_Server(Key, LocalIndex, NewId, Dummy, Reason, &Seq);
+    AckEditPrediction_Server(Req.PredictionId, Seq);
+    if (!bApplied) return EVoxelEditOutcome::Invalid;
+
+    // The cell already had that id: nothing to send
+    if (Seq == 0) return EVoxelEditOutcome::Unchanged;
+    CellsThisTick.Add(Cell, CellId);
 
-    // Broadcast to ALL clients (including owner)
+    // Broadcast to the clients streaming this chunk (including owner); sent coalesced on each controller's tick.
+    // Everyone else catches up from the sequence they hold when the chunk streams in.
+    FVoxelChunkDelta Delta;
+    Delta.ChunkXZ = FIntPoint(Key.X, Key.Z);
+    Delta.FromSeq = Seq - 1;
+    Delta.ToSeq = Seq;
+    FVoxelCellOp& Op = Delta.Ops.AddDefaulted_GetRef();
+    Op.LocalIndex = LocalIndex;
+    Op.BlockId = CellId;
     for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
     {
-        if (AVoxelPlayerController* PC = Cast<AVoxelPlayerController>(It->Get()))
+        AVoxelPlayerController* PC = Cast<AVoxelPlayerController>(It->Get());
+        if (PC && PC->IsChunkStreamedByClient(Delta.ChunkXZ))
         {
-            FBlockEditOp Op;
-            Op.ChunkXZ = FIntPoint(Key.X, Key.Z);
-            Op.LocalIndex = LocalIndex;
-            Op.NewBlockId = NewId;
-            PC->Client_ApplyRemoteBlockEdit(Op);
+            PC->QueueChunkDelta(FVoxelChunkDelta(Delta));
         }
     }
+    return EVoxelEditOutcome::Applied;
+}
+
+void AVoxelPlayerController::AdmitEdit_Server(AVoxelWorldManager* ServerMgr, const FBlockEditRequest& Req)
+{
+    // Token bucket: refills at EditTokensPerSecond up to EditTokenBurst
+    if (EditTokensPerSecond > 0.f)
+    {
+        const double Now = GetWorld()->GetTimeSeconds();
+        EditTokens = (EditTokens < 0.f) ? EditTokenBurst : FMath::Min(EditTokenBurst, EditTokens + (float)(Now - EditTokensTime) * EditTokensPerSecond);
+        EditTokensTime = Now;
+        if (EditTokens < 1.f)
+        {
+            if (ServerMgr) ServerMgr->NoteEditRateLimited_Server();
+            AckEditPrediction_Server(Req.PredictionId, 0);
+            return;
+        }
+        EditTokens -= 1.f;
+    }
+
+    if (!ServerMgr || !ServerMgr->EnqueueEdit_Server(this, Req))
+    {
+        AckEditPrediction_Server(Req.PredictionId, 0);
+    }
+}
+
+void AVoxelPlayerController::AckEditPrediction_Server(int32 PredictionId, int32 Seq)
+{
+    if (PredictionId == 0) return;
+
+    FVoxelEditPredictionAck& Ack = PendingPredictionAcks.AddDefaulted_GetRef();
+    Ack.PredictionId = PredictionId;
+    Ack.Seq = Seq;
 }
 
 // -----------------------------------------------------------------------------
-// Server → Client: apply one remote block edit to client-visual world
+// Client → Server: request an edit (place/remove) [single-op path]
 // -----------------------------------------------------------------------------
-void AVoxelPlayerController::Client_ApplyRemoteBlockEdit_Implementation(const FBlockEditOp& Op)
+void AVoxelPlayerController::Server_RequestBlockEdit_Implementation(const FBlockEditRequest& Req)
 {
-    if (!ClientVisualManager)
+    AdmitEdit_Server(GetAuthoritativeWorldManager(), Req);
+}
+
+// -----------------------------------------------------------------------------
+// Client → Server: many edits in one RPC
+// -----------------------------------------------------------------------------
+void AVoxelPlayerController::Server_RequestBlockEdits_Implementation(const TArray<FBlockEditRequest>& Reqs)
+{
+    AVoxelWorldManager* ServerMgr = GetAuthoritativeWorldManager();
+
+    // Queued in order, so they still resolve against the data as edited so far (e.g. stacked placements)
+    const int32 Count = FMath::Min(Reqs.Num(), MaxEditsPerBatch);
+    for (int32 i = 0; i < Count; ++i)
     {
-        // Fallback: find one if BP didn't wire it yet
-        TArray<AActor*> Found;
-        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AVoxelWorldManager::StaticClass(), Found);
-        for (AActor* A : Found)
+        AdmitEdit_Server(ServerMgr, Reqs[i]);
+    }
+
+    // Past the cap: dropped, which a predicting client must hear about too
+    for (int32 i = Count; i < Reqs.Num(); ++i)
+    {
+        AckEditPrediction_Server(Reqs[i].PredictionId, 0);
+    }
+}
+
+void AVoxelPlayerController::QueueBlockEditRequest(const FBlockEditRequest& Req)
+{
+    FBlockEditRequest& Queued = QueuedEditRequests.Add_GetRef(Req);
+    Queued.PredictionId = 0;
+
+    // Listen server / standalone edits apply on the spot; only remote clients wait for a round trip
+    if (bPredictEdits && GetNetMode() == NM_Client)
+    {
+        PredictEdit_Client(Queued);
+    }
+}
+
+bool AVoxelPlayerController::PredictEdit_Client(FBlockEditRequest& Req)
+{
+    // Only ray requests: the same grid walk the server runs, on the data as predicted so far
+    AVoxelWorldManager* Mgr = ResolveClientVisualManager();
+    if (!Mgr || Req.TraceDirection.IsNearlyZero()) return false;
+
+    FVoxelRayHit Hit;
+    const float MaxReach = FMath::Clamp(Req.ClaimedReach, 150.f, 800.f);
+    if (!Mgr->VoxelRaycast(Req.TraceStart, Req.TraceDirection, MaxReach, Hit)) return false;
+
+    const bool bForPlacement = (Req.Action == EVoxelEditAction::Place);
+    if (bForPlacement && !Hit.bHasPreviousCell) return false;
+
+    const FIntPoint ChunkXZ = bForPlacement ? Hit.PreviousChunkXZ : Hit.ChunkXZ;
+    const int32 LocalIndex = bForPlacement ? Hit.PreviousLocalIndex : Hit.LocalIndex;
+    const uint8 NewId = bForPlacement ? (uint8)FMath::Clamp(Req.NewBlockId, 0, (int32)UINT8_MAX) : 0;
+
+    const int32 PredictionId = NextPredictionId;
+    if (!Mgr->PredictBlockEdit(ChunkXZ, LocalIndex, NewId, PredictionId)) return false;
+
+    NextPredictionId = (NextPredictionId == MAX_int32) ? 1 : NextPredictionId + 1;
+    Req.PredictionId = PredictionId;
+    return true;
+}
+
+void AVoxelPlayerController::FlushPredictionAcks()
+{
+    if (PendingPredictionAcks.Num() == 0) return;
+
+    Client_ResolveEditPredictions(PendingPredictionAcks);
+    PendingPredictionAcks.Reset();
+}
+
+void AVoxelPlayerController::Client_ResolveEditPredictions_Implementation(const TArray<FVoxelEditPredictionAck>& Acks)
+{
+    if (!ResolveClientVisualManager()) return;
+
+    for (const FVoxelEditPredictionAck& Ack : Acks)
+    {
+        ClientVisualManager->ResolvePrediction(Ack.PredictionId, Ack.Seq);
+    }
+}
+
+void AVoxelPlayerController::FlushQueuedEditRequests()
+{
+    if (QueuedEditRequests.Num() == 0) return;
+
+    if (QueuedEditRequests.Num() == 1)
+    {
+        Server_RequestBlockEdit(QueuedEditRequests[0]);
+    }
+    else
+    {
+        for (int32 Start = 0; Start < QueuedEditRequests.Num(); Start += MaxEditsPerBatch)
         {
-            if (AVoxelWorldManager* M = Cast<AVoxelWorldManager>(A))
+            const int32 Num = FMath::Min(MaxEditsPerBatch, QueuedEditRequests.Num() - Start);
+            Server_RequestBlockEdits(TArray<FBlockEditRequest>(QueuedEditRequests.GetData() + Start, Num));
+        }
+    }
+    QueuedEditRequests.Reset();
+}
+
+bool AVoxelPlayerController::IsChunkStreamedByClient(const FIntPoint& ChunkXZ) const
+{
+    return !bFilterEditsByStreamedChunks || StreamedChunks.Contains(ChunkXZ);
+}
+
+void AVoxelPlayerController::Server_ReportChunksUnloaded_Implementation(const TArray<FIntPoint>& Chunks)
+{
+    for (const FIntPoint& C : Chunks)
+    {
+        StreamedChunks.Remove(C);
+    }
+
+    // Ops already queued for those chunks would only be parked client-side; the next snapshot covers them
+    PendingChunkDeltas.RemoveAll([this](const FVoxelChunkDelta& Delta) { return !StreamedChunks.Contains(Delta.ChunkXZ); });
+    OutgoingChunkDeltas.RemoveAll([this](const FVoxelChunkDelta& Delta) { return !StreamedChunks.Contains(Delta.ChunkXZ); });
+}
+
+void AVoxelPlayerController::QueueChunkDelta(FVoxelChunkDelta&& Delta)
+{
+    PendingChunkDeltas.Add(MoveTemp(Delta));
+}
+
+// Keep only the last op per cell, in order
+static void DedupeCellOps(TArray<FVoxelCellOp>& Ops)
+{
+    if (Ops.Num() < 2) return;
+
+    TArray<FVoxelCellOp> Kept;
+    Kept.Reserve(Ops.Num());
+    TSet<int32> Seen;
+    for (int32 i = Ops.Num() - 1; i >= 0; --i)
+    {
+        bool bAlreadySeen = false;
+        Seen.Add(Ops[i].LocalIndex, &bAlreadySeen);
+        if (!bAlreadySeen) Kept.Add(Ops[i]);
+    }
+    Algo::Reverse(Kept);
+    Ops = MoveTemp(Kept);
+}
+
+void AVoxelPlayerController::FlushChunkDeltas(float DeltaSeconds)
+{
+    // One delta per chunk where the sequences line up; a reset replaces whatever was queued before it
+    TArray<FVoxelChunkDelta> Merged;
+    TMap<FIntPoint, int32> LastSlot;
+    for (FVoxelChunkDelta& Delta : PendingChunkDeltas)
+    {
+        if (const int32* Slot = LastSlot.Find(Delta.ChunkXZ))
+        {
+            FVoxelChunkDelta& Prev = Merged[*Slot];
+            if (Delta.bReset)
+            {
+                Prev = MoveTemp(Delta);
+                continue;
+            }
+            if (Delta.ToSeq <= Prev.ToSeq) continue;
+            if (Delta.FromSeq <= Prev.ToSeq)
             {
-                if (M->bClientVisualInstance) { ClientVisualManager = M; break; }
+                Prev.Ops.Append(Delta.Ops);
+                Prev.ToSeq = Delta.ToSeq;
+                continue;
             }
         }
+        LastSlot.Add(Delta.ChunkXZ, Merged.Num());
+        Merged.Add(MoveTemp(Delta));
     }
-    if (!ClientVisualManager) return;
+    PendingChunkDeltas.Reset();
 
-    // Apply the single-op delta to the client-visual world
-    ClientVisualManager->ApplyVisualOpOrQueue(Op.ChunkXZ, Op.LocalIndex, Op.NewBlockId);
-
-    // --- NEW: verify-after-edit snapshot (throttled per chunk) ---
-    // This ensures that after rapid bursts, we reconcile to server truth.
-    if (IsLocalController()) // only the owning client asks; peers don't need to
+    // Big deltas (resets, bulk edits) become parts; the client applies them once the last one (bMore = false) is in
+    for (FVoxelChunkDelta& Delta : Merged)
     {
-        const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
-        const float* NextAllowed = NextSnapshotAllowedTime.Find(Op.ChunkXZ);
-        if (!NextAllowed || Now >= *NextAllowed)
+        DedupeCellOps(Delta.Ops);
+        if (Delta.Ops.Num() <= MaxOpsPerDeltaPart)
+        {
+            OutgoingChunkDeltas.Add(MoveTemp(Delta));
+            continue;
+        }
+        for (int32 Start = 0; Start < Delta.Ops.Num(); Start += MaxOpsPerDeltaPart)
         {
-            // Ask the server for the authoritative modified set for this chunk
-            Server_RequestChunkSnapshot(Op.ChunkXZ);
+            FVoxelChunkDelta& Part = OutgoingChunkDeltas.AddDefaulted_GetRef();
+            Part.ChunkXZ = Delta.ChunkXZ;
+            Part.FromSeq = Delta.FromSeq;
+            Part.ToSeq = Delta.ToSeq;
+            Part.bReset = Delta.bReset;
+            Part.Ops.Append(Delta.Ops.GetData() + Start, FMath::Min(MaxOpsPerDeltaPart, Delta.Ops.Num() - Start));
+            Part.bMore = Start + MaxOpsPerDeltaPart < Delta.Ops.Num();
+        }
+    }
+    if (OutgoingChunkDeltas.Num() == 0)
+    {
+        DeltaByteAllowance = 0.f;
+        return;
+    }
+
+    // Send while there is budget left; the delta that crosses zero still goes out, so the allowance may dip below it
+    const bool bBudgeted = MaxDeltaBytesPerSecond > 0;
+    if (bBudgeted)
+    {
+        DeltaByteAllowance = FMath::Min(DeltaByteAllowance + MaxDeltaBytesPerSecond * DeltaSeconds, (float)MaxDeltaBytesPerSecond);
+    }
 
-            // Cooldown ~150 ms per chunk to avoid spamming under bursts
-            NextSnapshotAllowedTime.Add(Op.ChunkXZ, Now + 0.15f);
+    TArray<FVoxelChunkDelta> Batch;
+    int32 BatchBytes = 0;
+    int32 NumSent = 0;
+    while (NumSent < OutgoingChunkDeltas.Num() && (!bBudgeted || DeltaByteAllowance > 0.f))
+    {
+        FVoxelChunkDelta& Delta = OutgoingChunkDeltas[NumSent++];
+
+        // Encoded once here; NetSerialize reuses the bytes
+        VoxelDeltaCodec::Encode(Delta.Ops, Delta.EncodedOps);
+        const int32 Bytes = Delta.EncodedOps.Num() + 16;
+        DeltaByteAllowance -= Bytes;
+
+        if (Batch.Num() > 0 && BatchBytes + Bytes > MaxDeltaBytesPerRPC)
+        {
+            Client_ApplyChunkDeltas(Batch);
+            Batch.Reset();
+            BatchBytes = 0;
         }
+        BatchBytes += Bytes;
+        Batch.Add(MoveTemp(Delta));
     }
+    if (Batch.Num() > 0)
+    {
+        Client_ApplyChunkDeltas(Batch);
+    }
+    OutgoingChunkDeltas.RemoveAt(0, NumSent);
 }
 
-
 // -----------------------------------------------------------------------------
-// One-chunk snapshot on request (used by initial/area sync)
+// Streamed chunk contents (client-visual managers with bStreamChunkContents)
 // -----------------------------------------------------------------------------
-void AVoxelPlayerController::Server_RequestChunkSnapshot_Implementation(FIntPoint ChunkXZ)
+bool AVoxelPlayerController::GetViewChunk_Server(const AVoxelWorldManager& ServerMgr, FIntPoint& OutChunk) const
+{
+    const AActor* Focus = GetPawn() ? static_cast<const AActor*>(GetPawn()) : GetViewTarget();
+    if (!Focus) return false;
+
+    const FVector L = Focus->GetActorLocation();
+    const double BS = (double)ServerMgr.BlockSize;
+    OutChunk = FIntPoint(FMath::FloorToInt(L.X / (CHUNK_SIZE_X * BS)), FMath::FloorToInt(L.Y / (CHUNK_SIZE_Z * BS)));
+    return true;
+}
+
+void AVoxelPlayerController::Server_RequestChunkContents_Implementation(const TArray<FVoxelChunkContentRequest>& Requests)
 {
     AVoxelWorldManager* ServerMgr = GetAuthoritativeWorldManager();
     if (!ServerMgr) return;
 
-    TArray<FBlockEditOp> Ops;
-    if (ServerMgr->GetChunkModifiedOps_Server(FChunkKey(ChunkXZ.X, ChunkXZ.Y), Ops))
+    // Only what a client could be streaming: generation is server CPU
+    FIntPoint Center;
+    if (!GetViewChunk_Server(*ServerMgr, Center)) return;
+    const int32 Radius = ServerMgr->RenderRadiusChunks + 2;
+
+    const int32 Num = FMath::Min(Requests.Num(), MaxContentRequestsPerRPC);
+    for (int32 i = 0; i < Num && PendingContentRequests.Num() < MaxPendingContentRequests; ++i)
     {
-        Client_ReceiveChunkSnapshot(ChunkXZ, Ops);
+        const FVoxelChunkContentRequest& Req = Requests[i];
+        if (FMath::Abs(Req.ChunkXZ.X - Center.X) > Radius || FMath::Abs(Req.ChunkXZ.Y - Center.Y) > Radius) continue;
+        PendingContentRequests.Add(Req.ChunkXZ, Req.Hash);
     }
 }
 
-static AVoxelWorldManager* FindLocalVisualManager(UWorld* W)
+void AVoxelPlayerController::FlushChunkContents(float DeltaSeconds)
 {
-    TArray<AActor*> Found;
-    UGameplayStatics::GetAllActorsOfClass(W, AVoxelWorldManager::StaticClass(), Found);
-    for (AActor* A : Found)
+    if (PendingContentRequests.Num() == 0)
+    {
+        ContentByteAllowance = 0.f;
+        return;
+    }
+
+    AVoxelWorldManager* ServerMgr = GetAuthoritativeWorldManager();
+    if (!ServerMgr) return;
+
+    const bool bBudgeted = MaxContentBytesPerSecond > 0;
+    if (bBudgeted)
     {
-        if (AVoxelWorldManager* M = Cast<AVoxelWorldManager>(A))
+        ContentByteAllowance = FMath::Min(ContentByteAllowance + MaxContentBytesPerSecond * DeltaSeconds, (float)MaxContentBytesPerSecond);
+        if (ContentByteAllowance <= 0.f) return;
+    }
+
+    // Nearest to the player first (the center moves, so re-sort every tick)
+    TArray<FIntPoint> Order;
+    PendingContentRequests.GenerateKeyArray(Order);
+    FIntPoint Center;
+    if (GetViewChunk_Server(*ServerMgr, Center))
+    {
+        Order.Sort([&Center](const FIntPoint& A, const FIntPoint& B)
+            {
+                const int32 DA = FMath::Max(FMath::Abs(A.X - Center.X), FMath::Abs(A.Y - Center.Y));
+                const int32 DB = FMath::Max(FMath::Abs(B.X - Center.X), FMath::Abs(B.Y - Center.Y));
+                return DA < DB;
+            });
+    }
+
+    // Same budget rule as deltas: the content that crosses zero still goes out
+    TArray<FVoxelChunkContent> Batch;
+    int32 BatchBytes = 0;
+    for (const FIntPoint& ChunkXZ : Order)
+    {
+        if (bBudgeted && ContentByteAllowance <= 0.f) break;
+
+        uint32 Hash = 0;
+        TSharedPtr<const TArray<uint8>> Payload;
+        if (!ServerMgr->GetChunkContent_Server(FChunkKey(ChunkXZ.X, ChunkXZ.Y), Hash, Payload)) continue;   // still encoding
+
+        FVoxelChunkContent Content;
+        Content.ChunkXZ = ChunkXZ;
+        Content.Hash = Hash;
+        if (PendingContentRequests.FindAndRemoveChecked(ChunkXZ) != Hash)
+        {
+            Content.Payload = *Payload;
+        }
+
+        const int32 Bytes = Content.Payload.Num() + 16;
+        ContentByteAllowance -= Bytes;
+        if (Batch.Num() > 0 && BatchBytes + Bytes > MaxContentBytesPerRPC)
         {
-            if (M->bClientVisualInstance) return M; // includes listen server local client
+            Client_ReceiveChunkContents(Batch);
+            Batch.Reset();
+            BatchBytes = 0;
         }
+        BatchBytes += Bytes;
+        Batch.Add(MoveTemp(Content));
+    }
+    if (Batch.Num() > 0)
+    {
+        Client_ReceiveChunkContents(Batch);
+    }
+}
+
+void AVoxelPlayerController::Client_ReceiveChunkContents_Implementation(const TArray<FVoxelChunkContent>& Contents)
+{
+    VOXEL_SCOPE(NetIngest);
+    if (!ResolveClientVisualManager()) return;
+
+    for (const FVoxelChunkContent& Content : Contents)
+    {
+        ClientVisualManager->ReceiveChunkContent(Content);
+    }
+}
+
+void AVoxelPlayerController::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    if (HasAuthority())
+    {
+        FlushChunkDeltas(DeltaSeconds);
+        FlushChunkContents(DeltaSeconds);
+        FlushPredictionAcks();
     }
-    return nullptr;
 }
 
-void AVoxelPlayerController::Client_ReceiveChunkSnapshot_Implementation(FIntPoint ChunkXZ, const TArray<FBlockEditOp>& Ops)
+void AVoxelPlayerController::PlayerTick(float DeltaTime)
+{
+    Super::PlayerTick(DeltaTime);
+
+    FlushQueuedEditRequests();
+}
+
+AVoxelWorldManager* AVoxelPlayerController::ResolveClientVisualManager()
 {
     if (!ClientVisualManager)
     {
-        if (UWorld* W = GetWorld())
+        // Fallback: look it up if BP didn't wire it yet (includes listen server local client)
+        if (const UVoxelWorldSubsystem* Registry = UVoxelWorldSubsystem::Get(GetWorld()))
         {
-            ClientVisualManager = FindLocalVisualManager(W);
+            ClientVisualManager = Registry->GetClientVisualManager();
         }
     }
-    if (!ClientVisualManager) return;
-    ClientVisualManager->ApplyOrQueueClientOps(ChunkXZ, Ops);
+    return ClientVisualManager;
 }
 
 // -----------------------------------------------------------------------------
-// Initial/area snapshot helpers (late-join correctness)
+// Server → Client: apply sequenced chunk deltas to the client-visual world
 // -----------------------------------------------------------------------------
-void AVoxelPlayerController::Server_RequestInitialChunkSnapshots_Implementation()
+void AVoxelPlayerController::Client_ApplyChunkDeltas_Implementation(const TArray<FVoxelChunkDelta>& Deltas)
 {
-    AVoxelWorldManager* Manager = nullptr;
+    VOXEL_SCOPE(NetIngest);
+    if (!ResolveClientVisualManager()) return;
+
+    for (const FVoxelChunkDelta& Part : Deltas)
     {
-        TArray<AActor*> Found;
-        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AVoxelWorldManager::StaticClass(), Found);
-        for (AActor* A : Found)
+        // Collect the parts of a split delta; a part for a different range means the rest of the old one was dropped
+        FVoxelChunkDelta Assembled;
+        bool bAssembled = false;
+        FVoxelChunkDelta* Partial = PartialChunkDeltas.Find(Part.ChunkXZ);
+        if (Partial && (Partial->FromSeq != Part.FromSeq || Partial->ToSeq != Part.ToSeq || Partial->bReset != Part.bReset))
         {
-            if (AVoxelWorldManager* M = Cast<AVoxelWorldManager>(A))
-            {
-                if (M->HasAuthority() && !M->bClientVisualInstance) { Manager = M; break; }
-            }
+            PartialChunkDeltas.Remove(Part.ChunkXZ);
+            Partial = nullptr;
+        }
+        if (Partial)
+        {
+            Partial->Ops.Append(Part.Ops);
+            if (Part.bMore) continue;
+            Assembled = MoveTemp(*Partial);
+            Assembled.bMore = false;
+            bAssembled = true;
+            PartialChunkDeltas.Remove(Part.ChunkXZ);
+        }
+        else if (Part.bMore)
+        {
+            PartialChunkDeltas.Add(Part.ChunkXZ, Part);
+            continue;
+        }
+        const FVoxelChunkDelta& Delta = bAssembled ? Assembled : Part;
+
+        if (ClientVisualManager->ApplyChunkDelta(Delta))
+        {
+            ResyncRequested.Remove(Delta.ChunkXZ);
+            continue;
         }
+
+        // Missed part of the stream: ask again from what we have (once, until answered)
+        if (!ResyncRequested.Contains(Delta.ChunkXZ))
+        {
+            ResyncRequested.Add(Delta.ChunkXZ);
+            Server_RequestChunkDeltas(ClientVisualManager->GetClientChunkVersion(Delta.ChunkXZ));
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Subscribe to one chunk (stream-in / resync)
+// -----------------------------------------------------------------------------
+void AVoxelPlayerController::Server_RequestChunkDeltas_Implementation(const FVoxelChunkVersion& Version)
+{
+    AVoxelWorldManager* ServerMgr = GetAuthoritativeWorldManager();
+    if (!ServerMgr) return;
+
+    // Same range as the area request: a chunk the client can't be streaming is dropped (loading it for the reply
+    // would generate it on the game thread)
+    FIntPoint ViewChunk;
+    if (!GetViewChunk_Server(*ServerMgr, ViewChunk)) return;
+    const int32 MaxRadius = ServerMgr->RenderRadiusChunks + 1;
+    if (FMath::Abs(Version.ChunkXZ.X - ViewChunk.X) > MaxRadius || FMath::Abs(Version.ChunkXZ.Y - ViewChunk.Y) > MaxRadius) return;
+
+    // From here on this client hears about edits to the chunk
+    StreamedChunks.Add(Version.ChunkXZ);
+
+    FVoxelChunkDelta Delta;
+    if (ServerMgr->BuildChunkDelta_Server(FChunkKey(Version.ChunkXZ.X, Version.ChunkXZ.Y), Version, Delta))
+    {
+        QueueChunkDelta(MoveTemp(Delta));
     }
-    if (!Manager) return;
+}
+
+// -----------------------------------------------------------------------------
+// Initial/area snapshot helpers (late-join correctness)
+// -----------------------------------------------------------------------------
+// A client only loads chunks within RenderRadiusChunks + 1 of its pawn: a Known list longer than that area is not worth reading
+static int32 GetMaxKnownChunkVersions(const AVoxelWorldManager& Manager)
+{
+    return FMath::Square(2 * (Manager.RenderRadiusChunks + 1) + 1);
+}
+
+void AVoxelPlayerController::Server_RequestInitialChunkSnapshots_Implementation(const TArray<FVoxelChunkVersion>& Known)
+{
+    AVoxelWorldManager* Manager = GetAuthoritativeWorldManager();
+    if (!Manager || Known.Num() > GetMaxKnownChunkVersions(*Manager)) return;
 
     APawn* P = GetPawn();
     if (!P) return;
@@ -185,45 +630,73 @@ void AVoxelPlayerController::Server_RequestInitialChunkSnapshots_Implementation(
     const FIntPoint Center(Cx, Cz);
     const int32 Radius = Manager->RenderRadiusChunks;
 
-    Server_RequestChunkSnapshotsForArea(Center, Radius);
+    Server_RequestChunkSnapshotsForArea(Center, Radius, Known);
+}
+
+void AVoxelPlayerController::GatherKnownChunkVersions(const FIntPoint& CenterChunk, int32 Radius, TArray<FVoxelChunkVersion>& OutKnown)
+{
+    OutKnown.Reset();
+    AVoxelWorldManager* Mgr = ResolveClientVisualManager();
+    if (!Mgr) return;
+
+    TArray<FChunkKey> Keys;
+    Mgr->GetLoadedChunkKeys(Keys);
+    for (const FChunkKey& K : Keys)
+    {
+        if (Radius >= 0 && (FMath::Abs(K.X - CenterChunk.X) > Radius || FMath::Abs(K.Z - CenterChunk.Y) > Radius)) continue;
+        OutKnown.Add(Mgr->GetClientChunkVersion(FIntPoint(K.X, K.Z)));
+    }
 }
 
 void AVoxelPlayerController::RequestInitialChunkSnapshotsBP()
 {
-    Server_RequestInitialChunkSnapshots();
+    // The server picks the area around the pawn; list only what it will read (RenderRadiusChunks + 1 around it)
+    TArray<FVoxelChunkVersion> Known;
+    AVoxelWorldManager* Mgr = ResolveClientVisualManager();
+    APawn* P = GetPawn();
+    if (Mgr && P)
+    {
+        const FVector L = P->GetActorLocation();
+        const double BS = (double)Mgr->BlockSize;
+        const FIntPoint Center(FMath::FloorToInt(L.X / (CHUNK_SIZE_X * BS)), FMath::FloorToInt(L.Y / (CHUNK_SIZE_Z * BS)));
+        GatherKnownChunkVersions(Center, Mgr->RenderRadiusChunks + 1, Known);
+    }
+    Server_RequestInitialChunkSnapshots(Known);
 }
 
 void AVoxelPlayerController::RequestChunkSnapshotsForAreaBP(FIntPoint CenterChunk, int32 Radius)
 {
-    Server_RequestChunkSnapshotsForArea(CenterChunk, Radius);
+    TArray<FVoxelChunkVersion> Known;
+    GatherKnownChunkVersions(CenterChunk, Radius, Known);
+    Server_RequestChunkSnapshotsForArea(CenterChunk, Radius, Known);
 }
 
-void AVoxelPlayerController::Server_RequestChunkSnapshotsForArea_Implementation(FIntPoint CenterChunk, int32 Radius)
+void AVoxelPlayerController::Server_RequestChunkSnapshotsForArea_Implementation(FIntPoint CenterChunk, int32 Radius, const TArray<FVoxelChunkVersion>& Known)
 {
-    AVoxelWorldManager* Manager = nullptr;
-    {
-        TArray<AActor*> Found;
-        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AVoxelWorldManager::StaticClass(), Found);
-        for (AActor* A : Found)
-        {
-            if (AVoxelWorldManager* M = Cast<AVoxelWorldManager>(A))
-            {
-                if (M->HasAuthority() && !M->bClientVisualInstance) { Manager = M; break; }
-            }
-        }
-    }
-    if (!Manager) return;
+    AVoxelWorldManager* Manager = GetAuthoritativeWorldManager();
+    if (!Manager || Known.Num() > GetMaxKnownChunkVersions(*Manager)) return;
+
+    // Every chunk answered joins the client's streamed set, so keep the area to what a client can stream: the center
+    // is the client's to pick, but the whole area has to stay within streaming range of its own pawn
+    FIntPoint ViewChunk;
+    if (!GetViewChunk_Server(*Manager, ViewChunk)) return;
 
-    for (int32 dz = -Radius; dz <= Radius; ++dz)
+    const int32 MaxRadius = Manager->RenderRadiusChunks + 1;
+    Radius = FMath::Clamp(Radius, 0, MaxRadius);
+    CenterChunk.X = FMath::Clamp(CenterChunk.X, ViewChunk.X - (MaxRadius - Radius), ViewChunk.X + (MaxRadius - Radius));
+    CenterChunk.Y = FMath::Clamp(CenterChunk.Y, ViewChunk.Y - (MaxRadius - Radius), ViewChunk.Y + (MaxRadius - Radius));
+
+    for (const FVoxelChunkVersion& Version : Known)
     {
-        for (int32 dx = -Radius; dx <= Radius; ++dx)
+        if (FMath::Abs(Version.ChunkXZ.X - CenterChunk.X) > Radius || FMath::Abs(Version.ChunkXZ.Y - CenterChunk.Y) > Radius) continue;
+
+        const FChunkKey Key(Version.ChunkXZ.X, Version.ChunkXZ.Y);
+        StreamedChunks.Add(Version.ChunkXZ);
+
+        FVoxelChunkDelta Delta;
+        if (Manager->BuildChunkDelta_Server(Key, Version, Delta))
         {
-            const FChunkKey Key(CenterChunk.X + dx, CenterChunk.Y + dz);
-            TArray<FBlockEditOp> Ops;
-            if (Manager->GetChunkModifiedOps_Server(Key, Ops) && Ops.Num() > 0)
-            {
-                Client_ReceiveChunkSnapshot(FIntPoint(Key.X, Key.Z), Ops);
-            }
+            QueueChunkDelta(MoveTemp(Delta));
         }
     }
 }
@@ -9,6 +9,7 @@
 #include "Serialization/BufferArchive.h"
 #include "Serialization/MemoryReader.h"
 #include "WorldPersistence.h"
+#include "VoxelStats.h"
 
 static constexpr uint32 VCD_MAGIC = 0x44435631; // 'VCD1'
 static constexpr uint16 VCD_VER = 1;
@@ -75,6 +76,7 @@ namespace VoxelSaveSystem
             R << Index; R << Id;
             Data.ModifiedBlocks.Add(Index, (uint16)Id);
         }
+        Data.RecomputeExtents();
         return true;
     }
 
@@ -111,11 +113,13 @@ namespace VoxelSaveSystem
     // World-name based IO (new canonical path)
     bool LoadDeltaByWorld(const FString& WorldName, FVoxelChunkData& Data)
     {
+        VOXEL_SCOPE(DeltaLoad);
         return LoadDeltaFromPath(GetWorldChunkPath(WorldName, Data.Key), Data);
     }
 
     bool SaveDeltaByWorld(const FString& WorldName, const FVoxelChunkData& Data)
     {
+        VOXEL_SCOPE(Save);
         return SaveDeltaToPath(GetWorldChunkPath(WorldName, Data.Key), Data);
     }
 
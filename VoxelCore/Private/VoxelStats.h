@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// Voxel pipeline instrumentation.
+// - `stat voxel` shows the stages and counters below.
+// - VOXEL_SCOPE stages are also CPU events in Unreal Insights (-trace=cpu; add the stats channel for the counters).
+// - In CSV captures (csvprofile start/stop) they appear under the Voxel category.
+// Generate, DeltaLoad, ContentDecode, ContentEncode, MeshBuild, CollisionBuild and Save run mostly on worker
+// threads; the other stages run on the game thread.
+DECLARE_STATS_GROUP(TEXT("Voxel"), STATGROUP_Voxel, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Generate"), STAT_VoxelGenerate, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Delta Load"), STAT_VoxelDeltaLoad, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Content Decode"), STAT_VoxelContentDecode, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Content Encode"), STAT_VoxelContentEncode, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mesh Build"), STAT_VoxelMeshBuild, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Collision Build"), STAT_VoxelCollisionBuild, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save"), STAT_VoxelSave, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Drain"), STAT_VoxelDrain, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Actor Spawn/Upload"), STAT_VoxelActorSpawn, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Collision Cook"), STAT_VoxelCollisionCook, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Streaming Update"), STAT_VoxelStreamingUpdate, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Edit Drain"), STAT_VoxelEditDrain, STATGROUP_Voxel, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Net Ingest"), STAT_VoxelNetIngest, STATGROUP_Voxel, );
+
+// Per-frame counters, summed over every manager in the process (server + client visual on a listen server).
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Loaded Chunks"), STAT_VoxelLoadedChunks, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pending Builds"), STAT_VoxelPendingBuilds, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pending LOD Builds"), STAT_VoxelPendingLODBuilds, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Edit Queue Depth"), STAT_VoxelEditQueueDepth, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Chunks With Queued Ops"), STAT_VoxelQueuedOpChunks, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Content Requests In Flight"), STAT_VoxelContentRequests, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Content Encodes In Flight"), STAT_VoxelContentEncodes, STATGROUP_Voxel, );
+// Drained chunks, vertices and bytes count render sections only (collision-only results and collision sections are left out)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Chunks Drained"), STAT_VoxelChunksDrained, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Vertices Drained"), STAT_VoxelVerticesDrained, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Bytes Drained"), STAT_VoxelMeshBytesDrained, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Bytes In"), STAT_VoxelNetBytesIn, STATGROUP_Voxel, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Bytes Out"), STAT_VoxelNetBytesOut, STATGROUP_Voxel, );
+
+// Averages over the chunks drained this frame (kept from the last frame that drained any).
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Vertices / Chunk"), STAT_VoxelVerticesPerChunk, STATGROUP_Voxel, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Mesh Bytes / Chunk"), STAT_VoxelMeshBytesPerChunk, STATGROUP_Voxel, );
+
+CSV_DECLARE_CATEGORY_EXTERN(Voxel);
+
+// Cycle stat, Insights event and CSV timing for one stage: VOXEL_SCOPE(MeshBuild) -> STAT_VoxelMeshBuild.
+#define VOXEL_SCOPE(Stage) \
+    SCOPE_CYCLE_COUNTER(STAT_Voxel##Stage); \
+    TRACE_CPUPROFILER_EVENT_SCOPE(Voxel_##Stage); \
+    CSV_SCOPED_TIMING_STAT(Voxel, Stage)
+
+// Add to a per-frame counter: VOXEL_COUNT(NetBytesIn, N) -> STAT_VoxelNetBytesIn and CSV Voxel/NetBytesIn.
+#define VOXEL_COUNT(Name, Value) \
+    INC_DWORD_STAT_BY(STAT_Voxel##Name, Value); \
+    CSV_CUSTOM_STAT(Voxel, Name, (int32)(Value), ECsvCustomStatOp::Accumulate)
+
+// Set an average: VOXEL_SET_AVERAGE(VerticesPerChunk, X) -> STAT_VoxelVerticesPerChunk and CSV Voxel/VerticesPerChunk.
+#define VOXEL_SET_AVERAGE(Name, Value) \
+    SET_FLOAT_STAT(STAT_Voxel##Name, Value); \
+    CSV_CUSTOM_STAT(Voxel, Name, (float)(Value), ECsvCustomStatOp::Set)
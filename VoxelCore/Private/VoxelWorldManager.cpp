@@ -7,11 +7,15 @@
 #include "VoxelSaveSystem.h"
 #include "WorldPersistence.h"
 #include "VoxelPlayerController.h"
-#include "VoxelChunkNetState.h"
+#include "VoxelWorldSubsystem.h"
+#include "VoxelFarTerrainActor.h"
+#include "VoxelDeltaCodec.h"
+#include "VoxelStats.h"
 
 #include "Kismet/GameplayStatics.h"
 #include "Async/Async.h"
 #include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
 #include <cstdio> // sscanf
 
 // ---------- ctor / lifecycle ----------
@@ -27,6 +31,15 @@ void AVoxelWorldManager::BeginPlay()
 {
     Super::BeginPlay();
 
+    if (UVoxelWorldSubsystem* Registry = UVoxelWorldSubsystem::Get(GetWorld()))
+    {
+        Registry->RegisterManager(this);
+    }
+
+    ClientEditCache.Empty(FMath::Max(0, MaxCachedChunkEdits));
+    ContentCache.Empty(FMath::Max(1, MaxCachedChunkContents));
+    ServedContents.Empty(FMath::Max(1, MaxServedChunkContents));
+
     // On clients, only allow ticking if this instance was explicitly spawned as a "client visual instance".
     if (!HasAuthority() && !bClientVisualInstance)
     {
@@ -76,6 +89,8 @@ void AVoxelWorldManager::ApplyOrQueueClientOps(FIntPoint ChunkXZ, const TArray<F
     }
 
     // Chunk data is here: apply immediately and rebuild.
+    uint8 BorderSides = 0;
+    uint32 Sections = 0;
     for (const FBlockEditOp& Op : Ops)
     {
         if (Op.LocalIndex < 0 || Op.LocalIndex >= CHUNK_VOLUME) continue;
@@ -88,47 +103,16 @@ void AVoxelWorldManager::ApplyOrQueueClientOps(FIntPoint ChunkXZ, const TArray<F
             static_cast<EBlockId>(FMath::Clamp(Op.NewBlockId, 0, (int32)UINT8_MAX)),
             /*bMarkModified*/true
         );
+        BorderSides |= BorderSidesForCell(LX, LZ);
+        Sections |= FVoxelMesher_Naive::GetSectionMaskForCellY(LY);
     }
+    if (Sections == 0) return;
 
     Rec->bDirty = true;
-    KickBuild(Key, Rec->Data);
-}
-
-void AVoxelWorldManager::IngestReplicatedCells(const FIntPoint& ChunkXZ, const TArray<FModifiedCell>& Cells)
-{
-    const FChunkKey Key(ChunkXZ.X, ChunkXZ.Y);
-
-    // If the chunk is already present locally, apply immediately and rebuild.
-    if (FChunkRecord* Rec = Loaded.Find(Key))
-    {
-        if (Rec->Data.IsValid())
-        {
-            for (const FModifiedCell& C : Cells)
-            {
-                int32 LX = 0, LY = 0, LZ = 0;
-                XYZFromIndex(C.LocalIndex, LX, LY, LZ);
-                Rec->Data->SetBlockAt(LX, LY, LZ, (EBlockId)C.BlockId, /*bMarkModified*/true);
-            }
-            Rec->bDirty = true;
-            KickBuild(Key, Rec->Data);
-            return;
-        }
-    }
-
-    // If the chunk isn't loaded yet here, queue for when it streams in.
-    TArray<FNetModifiedBlock>& Queue = PendingNetDeltas.FindOrAdd(Key);
-    Queue.Reserve(Queue.Num() + Cells.Num());
-    for (const FModifiedCell& C : Cells)
-    {
-        FNetModifiedBlock B;
-        XYZFromIndex(C.LocalIndex, B.X, B.Y, B.Z);
-        B.Id = C.BlockId;
-        Queue.Add(B);
-    }
+    KickBuild(Key, Rec->Data, Sections);
+    RemeshNeighbors(Key, BorderSides, Sections);
 }
 
-
-
 bool AVoxelWorldManager::ApplyVisualBlockEdit_ClientBP(FIntPoint ChunkXZ, int32 LocalIndex, int32 NewBlockId)
 {
     const FChunkKey ChunkKeyLocal(ChunkXZ.X, ChunkXZ.Y);
@@ -156,8 +140,10 @@ bool AVoxelWorldManager::ApplyVisualBlockEdit_ClientBP(FIntPoint ChunkXZ, int32
     const int32 ClampedId = FMath::Clamp(NewBlockId, 0, (int32)UINT8_MAX);
     Rec->Data->SetBlockAt(LX, LY, LZ, static_cast<EBlockId>(ClampedId), /*bMarkModified*/true);
 
+    const uint32 Sections = FVoxelMesher_Naive::GetSectionMaskForCellY(LY);
     Rec->bDirty = true;
-    KickBuild(ChunkKeyLocal, Rec->Data);
+    KickBuild(ChunkKeyLocal, Rec->Data, Sections);
+    RemeshNeighbors(ChunkKeyLocal, BorderSidesForCell(LX, LZ), Sections);
     return true;
 }
 
@@ -191,6 +177,332 @@ bool AVoxelWorldManager::ResolveVoxelFromHit(const FVector& WorldHit,
     return true;
 }
 
+// Global cell lookups over loaded chunk data, caching the last chunk (queries touch few chunks).
+struct FVoxelCellSampler
+{
+    const TMap<FChunkKey, FChunkRecord>& Loaded;
+    FChunkKey CachedKey = FChunkKey(MAX_int32, MAX_int32);
+    const FVoxelChunkData* CachedData = nullptr;
+
+    explicit FVoxelCellSampler(const TMap<FChunkKey, FChunkRecord>& InLoaded) : Loaded(InLoaded) {}
+
+    // Global cell (X, Y vertical, Z): 0 = air, 1 = solid, -1 = unknown (chunk not loaded, or below the world).
+    // Key/local index are only set for cells inside the world's height.
+    int32 Sample(int32 GX, int32 GY, int32 GZ, FChunkKey& OutKey, int32& OutLocal, EBlockId& OutId)
+    {
+        if (GY < 0) return -1;
+        if (GY >= CHUNK_SIZE_Y) return 0;
+
+        const int32 CX = FMath::FloorToInt((double)GX / (double)CHUNK_SIZE_X);
+        const int32 CZ = FMath::FloorToInt((double)GZ / (double)CHUNK_SIZE_Z);
+        OutKey = FChunkKey(CX, CZ);
+        if (!(OutKey == CachedKey))
+        {
+            const FChunkRecord* Rec = Loaded.Find(OutKey);
+            CachedKey = OutKey;
+            CachedData = (Rec && Rec->Data.IsValid()) ? Rec->Data.Get() : nullptr;
+        }
+        if (!CachedData) return -1;
+
+        const int32 LX = GX - CX * CHUNK_SIZE_X;
+        const int32 LZ = GZ - CZ * CHUNK_SIZE_Z;
+        OutLocal = IndexFromXYZ(LX, GY, LZ);
+        OutId = CachedData->GetBlockAt(LX, GY, LZ);
+        return (OutId != EBlockId::Air) ? 1 : 0;
+    }
+
+    // Movement queries: unknown space blocks, so nothing falls through a chunk that hasn't streamed in.
+    // World-axis cell (x, y, z) = voxel (X, Z, Y).
+    bool IsBlockingWorldCell(int32 WX, int32 WY, int32 WZ)
+    {
+        FChunkKey Key;
+        int32 Local = 0;
+        EBlockId Id = EBlockId::Air;
+        return Sample(WX, WZ, WY, Key, Local, Id) != 0;
+    }
+};
+
+bool AVoxelWorldManager::VoxelRaycast(const FVector& Start, const FVector& Direction, float MaxDistance, FVoxelRayHit& OutHit) const
+{
+    OutHit = FVoxelRayHit();
+
+    const FVector Dir = Direction.GetSafeNormal();
+    if (Dir.IsNearlyZero() || MaxDistance <= 0.f || BlockSize <= 0.f) return false;
+
+    // Grid space in world axis order, one unit per block, shifted so cell i spans [i, i + 1)
+    // (cells are centered on i * BlockSize). Grid x/y/z = voxel X/Z/Y.
+    const double InvBS = 1.0 / (double)BlockSize;
+    const FVector P = Start * InvBS + FVector(0.5);
+    const double MaxT = (double)MaxDistance * InvBS;
+
+    int32 Cell[3] = { FMath::FloorToInt(P.X), FMath::FloorToInt(P.Y), FMath::FloorToInt(P.Z) };
+    int32 Step[3];
+    double TMax[3], TDelta[3];
+    for (int32 i = 0; i < 3; ++i)
+    {
+        const double D = Dir[i];
+        Step[i] = (D > 0.0) ? 1 : ((D < 0.0) ? -1 : 0);
+        TDelta[i] = (Step[i] != 0) ? FMath::Abs(1.0 / D) : DBL_MAX;
+        TMax[i] = (Step[i] > 0) ? ((Cell[i] + 1) - P[i]) / D
+                : (Step[i] < 0) ? (P[i] - Cell[i]) / -D
+                : DBL_MAX;
+    }
+
+    FVoxelCellSampler Cells(Loaded);
+    auto Sample = [&Cells](const int32 (&C)[3], FChunkKey& OutKey, int32& OutLocal, EBlockId& OutId)
+        {
+            return Cells.Sample(C[0], C[2], C[1], OutKey, OutLocal, OutId);
+        };
+
+    FChunkKey Key;
+    int32 Local = 0;
+    EBlockId Id = EBlockId::Air;
+
+    // Starting inside a block: that block is the hit, with no face or previous cell
+    int32 State = Sample(Cell, Key, Local, Id);
+    if (State == 1)
+    {
+        OutHit.ChunkXZ = FIntPoint(Key.X, Key.Z);
+        OutHit.LocalIndex = Local;
+        OutHit.BlockId = static_cast<int32>(Id);
+        OutHit.WorldHitLocation = Start;
+        return true;
+    }
+    if (State < 0) return false;
+
+    FChunkKey PrevKey = Key;
+    int32 PrevLocal = Local;
+    bool bPrevInWorld = (Cell[2] < CHUNK_SIZE_Y);
+
+    // Each step crosses one face; bounded by the distance, so this always terminates
+    const int32 MaxSteps = 3 * (FMath::CeilToInt(MaxT) + 1);
+    for (int32 StepIdx = 0; StepIdx < MaxSteps; ++StepIdx)
+    {
+        const int32 Axis = (TMax[0] < TMax[1]) ? ((TMax[0] < TMax[2]) ? 0 : 2) : ((TMax[1] < TMax[2]) ? 1 : 2);
+        const double T = TMax[Axis];
+        if (T > MaxT) break;
+
+        Cell[Axis] += Step[Axis];
+        TMax[Axis] += TDelta[Axis];
+
+        State = Sample(Cell, Key, Local, Id);
+        if (State < 0) return false;
+        if (State == 1)
+        {
+            OutHit.ChunkXZ = FIntPoint(Key.X, Key.Z);
+            OutHit.LocalIndex = Local;
+            OutHit.BlockId = static_cast<int32>(Id);
+
+            OutHit.bHasPreviousCell = bPrevInWorld;
+            OutHit.PreviousChunkXZ = FIntPoint(PrevKey.X, PrevKey.Z);
+            OutHit.PreviousLocalIndex = PrevLocal;
+
+            FVector Normal = FVector::ZeroVector;
+            Normal[Axis] = -Step[Axis];
+            OutHit.HitNormal = Normal;
+            OutHit.Distance = (float)(T * BlockSize);
+            OutHit.WorldHitLocation = Start + Dir * OutHit.Distance;
+            return true;
+        }
+
+        // Air above the world has no cell to place into
+        PrevKey = Key;
+        PrevLocal = Local;
+        bPrevInWorld = (Cell[2] < CHUNK_SIZE_Y);
+    }
+    return false;
+}
+
+// ---------- voxel collision queries ----------
+
+// World coordinate -> cell index along one axis (cell i spans [i - 0.5, i + 0.5] * BlockSize).
+static FORCEINLINE int32 WorldToCellIndex(double W, double InvBS)
+{
+    return FMath::FloorToInt(W * InvBS + 0.5);
+}
+
+bool AVoxelWorldManager::VoxelOverlapBox(const FVector& Center, const FVector& Extent) const
+{
+    const double InvBS = 1.0 / (double)BlockSize;
+    const double Skin = BlockSize * 1e-3;
+
+    // Touching a face is not overlapping
+    int32 Lo[3], Hi[3];
+    for (int32 a = 0; a < 3; ++a)
+    {
+        Lo[a] = WorldToCellIndex(Center[a] - Extent[a] + Skin, InvBS);
+        Hi[a] = WorldToCellIndex(Center[a] + Extent[a] - Skin, InvBS);
+    }
+
+    FVoxelCellSampler Cells(Loaded);
+    for (int32 z = Lo[2]; z <= Hi[2]; ++z)
+    {
+        for (int32 y = Lo[1]; y <= Hi[1]; ++y)
+        {
+            for (int32 x = Lo[0]; x <= Hi[0]; ++x)
+            {
+                if (Cells.IsBlockingWorldCell(x, y, z)) return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool AVoxelWorldManager::VoxelSweepBox(const FVector& Center, const FVector& Extent, const FVector& Delta, float& OutTime, FVector& OutNormal) const
+{
+    OutTime = 1.f;
+    OutNormal = FVector::ZeroVector;
+    if (Delta.IsNearlyZero()) return false;
+
+    const double BS = BlockSize;
+    const double InvBS = 1.0 / BS;
+    const double Skin = BS * 1e-3;
+    FVoxelCellSampler Cells(Loaded);
+
+    // Sub-steps of at most one block keep the broadphase to a few cells per step
+    const int32 NumSteps = FMath::Max(1, FMath::CeilToInt(Delta.GetAbsMax() * InvBS));
+    const FVector StepDelta = Delta / NumSteps;
+
+    for (int32 s = 0; s < NumSteps; ++s)
+    {
+        const FVector C = Center + StepDelta * s;
+
+        // Cells touched by the box over this step
+        int32 Lo[3], Hi[3];
+        for (int32 a = 0; a < 3; ++a)
+        {
+            const double Min = FMath::Min(C[a], C[a] + StepDelta[a]) - Extent[a];
+            const double Max = FMath::Max(C[a], C[a] + StepDelta[a]) + Extent[a];
+            Lo[a] = WorldToCellIndex(Min + Skin, InvBS);
+            Hi[a] = WorldToCellIndex(Max - Skin, InvBS);
+        }
+
+        double BestT = 2.0;
+        int32 BestAxis = INDEX_NONE;
+        for (int32 z = Lo[2]; z <= Hi[2]; ++z)
+        {
+            for (int32 y = Lo[1]; y <= Hi[1]; ++y)
+            {
+                for (int32 x = Lo[0]; x <= Hi[0]; ++x)
+                {
+                    if (!Cells.IsBlockingWorldCell(x, y, z)) continue;
+
+                    // Slab test of the box center against the cell grown by Extent (Minkowski sum)
+                    const int32 Cell[3] = { x, y, z };
+                    double TEnter = -DBL_MAX, TExit = DBL_MAX;
+                    int32 EnterAxis = INDEX_NONE;
+                    bool bMiss = false;
+                    for (int32 a = 0; a < 3 && !bMiss; ++a)
+                    {
+                        const double CellLo = (Cell[a] - 0.5) * BS - Extent[a];
+                        const double CellHi = (Cell[a] + 0.5) * BS + Extent[a];
+                        const double D = StepDelta[a];
+                        if (FMath::IsNearlyZero(D))
+                        {
+                            bMiss = (C[a] <= CellLo + Skin || C[a] >= CellHi - Skin);
+                            continue;
+                        }
+
+                        double T0 = (CellLo - C[a]) / D;
+                        double T1 = (CellHi - C[a]) / D;
+                        if (T0 > T1) Swap(T0, T1);
+                        if (T0 > TEnter) { TEnter = T0; EnterAxis = a; }
+                        TExit = FMath::Min(TExit, T1);
+                    }
+                    if (bMiss || EnterAxis == INDEX_NONE || TEnter > TExit || TExit <= 0.0 || TEnter >= 1.0) continue;
+
+                    if (TEnter < 0.0)
+                    {
+                        // Already inside this cell by more than the skin: let the box move out
+                        const double CellLo = (Cell[EnterAxis] - 0.5) * BS - Extent[EnterAxis];
+                        const double CellHi = (Cell[EnterAxis] + 0.5) * BS + Extent[EnterAxis];
+                        if (C[EnterAxis] > CellLo + Skin && C[EnterAxis] < CellHi - Skin) continue;
+                        TEnter = 0.0;
+                    }
+
+                    if (TEnter < BestT)
+                    {
+                        BestT = TEnter;
+                        BestAxis = EnterAxis;
+                    }
+                }
+            }
+        }
+
+        if (BestAxis != INDEX_NONE)
+        {
+            OutTime = (float)((s + BestT) / NumSteps);
+            OutNormal[BestAxis] = (StepDelta[BestAxis] > 0.0) ? -1.0 : 1.0;
+            return true;
+        }
+    }
+    return false;
+}
+
+FVector AVoxelWorldManager::VoxelSlideBox(const FVector& Center, const FVector& Extent, const FVector& Delta, uint8& OutBlockedAxes) const
+{
+    OutBlockedAxes = 0;
+
+    const double BS = BlockSize;
+    const double InvBS = 1.0 / BS;
+    const double Skin = BS * 1e-3;
+    FVoxelCellSampler Cells(Loaded);
+
+    FVector Min = Center - Extent;
+    FVector Max = Center + Extent;
+    FVector Applied = FVector::ZeroVector;
+
+    // Vertical first, so walking into a wall while falling still lands
+    static const int32 AxisOrder[3] = { 2, 0, 1 };
+    for (const int32 Axis : AxisOrder)
+    {
+        double D = Delta[Axis];
+        if (D == 0.0) continue;
+
+        // Cross-section of the box on the other two axes (touching faces don't count)
+        const int32 A1 = (Axis + 1) % 3;
+        const int32 A2 = (Axis + 2) % 3;
+        const int32 Lo1 = WorldToCellIndex(Min[A1] + Skin, InvBS), Hi1 = WorldToCellIndex(Max[A1] - Skin, InvBS);
+        const int32 Lo2 = WorldToCellIndex(Min[A2] + Skin, InvBS), Hi2 = WorldToCellIndex(Max[A2] - Skin, InvBS);
+
+        auto LayerBlocks = [&](int32 Layer)
+            {
+                int32 Cell[3];
+                Cell[Axis] = Layer;
+                for (Cell[A1] = Lo1; Cell[A1] <= Hi1; ++Cell[A1])
+                {
+                    for (Cell[A2] = Lo2; Cell[A2] <= Hi2; ++Cell[A2])
+                    {
+                        if (Cells.IsBlockingWorldCell(Cell[0], Cell[1], Cell[2])) return true;
+                    }
+                }
+                return false;
+            };
+
+        // Walk layers ahead of the leading face; stop at the first one that blocks. Layers the box is already
+        // inside (near face behind it by more than the skin) are skipped so a stuck box can move out.
+        const int32 Dir = (D > 0.0) ? 1 : -1;
+        const double Face = (D > 0.0) ? Max[Axis] : Min[Axis];
+        const int32 First = WorldToCellIndex(Face, InvBS);
+        const int32 Last = WorldToCellIndex(Face + D, InvBS);
+        for (int32 Layer = First; Layer != Last + Dir; Layer += Dir)
+        {
+            const double NearFace = (Layer - 0.5 * Dir) * BS;
+            if ((NearFace - Face) * Dir < -Skin) continue;
+            if (!LayerBlocks(Layer)) continue;
+
+            D = (Dir > 0) ? FMath::Max(0.0, NearFace - Face) : FMath::Min(0.0, NearFace - Face);
+            OutBlockedAxes |= (1 << Axis);
+            break;
+        }
+
+        Min[Axis] += D;
+        Max[Axis] += D;
+        Applied[Axis] = D;
+    }
+    return Applied;
+}
+
 bool AVoxelWorldManager::EnsureChunkDataLoaded_ForEdit(const FChunkKey& Key, FChunkRecord*& OutRec)
 {
     if (FChunkRecord* Found = Loaded.Find(Key))
@@ -221,8 +533,10 @@ bool AVoxelWorldManager::ApplyBlockEdit_Server(const FChunkKey& ChunkKey,
     int32 LocalIndex,
     int32 NewBlockId,
     TArray<FChunkKey>& OutChunksNeedingRebuild,
-    FString& OutFail)
+    FString& OutFail,
+    int32* OutSeq)
 {
+    if (OutSeq) *OutSeq = 0;
     if (!HasAuthority()) { OutFail = TEXT("Server only"); return false; }
 
     FChunkRecord* Rec = Loaded.Find(ChunkKey);
@@ -240,50 +554,150 @@ bool AVoxelWorldManager::ApplyBlockEdit_Server(const FChunkKey& ChunkKey,
     int32 LX = 0, LY = 0, LZ = 0;
     XYZFromIndex(LocalIndex, LX, LY, LZ);
 
+    // Only the slab(s) around the edited layer are remeshed (and, on the packed path, re-uploaded)
+    const uint32 Sections = FVoxelMesher_Naive::GetSectionMaskForCellY(LY);
+
     const uint8 ClampedId = (uint8)FMath::Clamp(NewBlockId, 0, (int32)UINT8_MAX);
     const EBlockId OldId = Rec->Data->GetBlockAt(LX, LY, LZ);
     if ((uint8)OldId == ClampedId)
     {
         OutChunksNeedingRebuild.Add(ChunkKey);
-        KickBuild(ChunkKey, Rec->Data);
+        if (EditBatchDepth > 0)
+        {
+            DeferredEditRemesh.FindOrAdd(ChunkKey).Sections |= Sections;
+            return true;
+        }
+        KickBuild(ChunkKey, Rec->Data, Sections);
         return true;
     }
 
+    // Log before writing: a new log looks at the modified set as it was before this edit
+    FChunkDeltaLog& Log = GetDeltaLog_Server(ChunkKey, *Rec->Data);
+
     Rec->Data->SetBlockAt(LX, LY, LZ, (EBlockId)ClampedId, /*bMarkModified*/true);
     Rec->bDirty = true;
 
-    OutChunksNeedingRebuild.Add(ChunkKey);
-    KickBuild(ChunkKey, Rec->Data);
+    FVoxelCellOp& LogOp = Log.Recent.AddDefaulted_GetRef();
+    LogOp.LocalIndex = LocalIndex;
+    LogOp.BlockId = ClampedId;
+    ++Log.HeadSeq;
+    if (Log.Recent.Num() > FMath::Max(1, MaxDeltaLogOps))
+    {
+        // Drop the older half; clients further behind than that get a reset
+        const int32 Drop = Log.Recent.Num() / 2;
+        Log.Recent.RemoveAt(0, Drop, EAllowShrinking::No);
+        Log.BaseSeq += Drop;
+    }
+    if (OutSeq) *OutSeq = Log.HeadSeq;
 
-    // Publish to replicated per-chunk net state
-    if (AVoxelChunkNetState* NS = GetOrCreateNetState_Server(ChunkKey))
+    OutChunksNeedingRebuild.Add(ChunkKey);
+    if (EditBatchDepth > 0)
     {
-        NS->ServerApplyCellChange(LocalIndex, ClampedId);
+        FDeferredEditRemesh& Deferred = DeferredEditRemesh.FindOrAdd(ChunkKey);
+        Deferred.Sections |= Sections;
+        Deferred.BorderSides |= BorderSidesForCell(LX, LZ);
+        return true;
     }
 
-    // Neighbor invalidation for border edits (mesh only)
-    if (LX == 0) {
-        FChunkKey NK = ChunkKey; NK.X -= 1;
-        if (FChunkRecord* NRec = Loaded.Find(NK)) { OutChunksNeedingRebuild.Add(NK); KickBuild(NK, NRec->Data); }
+    KickBuild(ChunkKey, Rec->Data, Sections);
+
+    // Neighbor invalidation for border edits (mesh only): their border snapshot of this chunk changed
+    RemeshNeighbors(ChunkKey, BorderSidesForCell(LX, LZ), Sections, &OutChunksNeedingRebuild);
+    return true;
+}
+
+void AVoxelWorldManager::BeginEditBatch()
+{
+    ++EditBatchDepth;
+}
+
+void AVoxelWorldManager::EndEditBatch()
+{
+    if (EditBatchDepth <= 0 || --EditBatchDepth > 0) return;
+
+    TMap<FChunkKey, FDeferredEditRemesh> ToRebuild = MoveTemp(DeferredEditRemesh);
+    DeferredEditRemesh.Reset();
+    for (const TPair<FChunkKey, FDeferredEditRemesh>& Pair : ToRebuild)
+    {
+        RequestRemesh(Pair.Key, Pair.Value.Sections);
+        RemeshNeighbors(Pair.Key, Pair.Value.BorderSides, Pair.Value.Sections);
     }
-    else if (LX == CHUNK_SIZE_X - 1) {
-        FChunkKey NK = ChunkKey; NK.X += 1;
-        if (FChunkRecord* NRec = Loaded.Find(NK)) { OutChunksNeedingRebuild.Add(NK); KickBuild(NK, NRec->Data); }
+}
+
+bool AVoxelWorldManager::EnqueueEdit_Server(AVoxelPlayerController* Requester, const FBlockEditRequest& Req)
+{
+    if (EditQueue.Num() - EditQueueHead >= MaxQueuedEdits)
+    {
+        ++EditStats.RejectedQueueFull;
+        return false;
     }
-    if (LZ == 0) {
-        FChunkKey NK = ChunkKey; NK.Z -= 1;
-        if (FChunkRecord* NRec = Loaded.Find(NK)) { OutChunksNeedingRebuild.Add(NK); KickBuild(NK, NRec->Data); }
+
+    FQueuedEdit& Queued = EditQueue.AddDefaulted_GetRef();
+    Queued.Requester = Requester;
+    Queued.Req = Req;
+
+    ++EditStats.Admitted;
+    EditStats.QueueDepth = EditQueue.Num() - EditQueueHead;
+    EditStats.PeakQueueDepth = FMath::Max(EditStats.PeakQueueDepth, EditStats.QueueDepth);
+    return true;
+}
+
+void AVoxelWorldManager::DrainEditQueue_Server()
+{
+    if (EditQueueHead >= EditQueue.Num()) return;
+    VOXEL_SCOPE(EditDrain);
+
+    const double StartSec = FPlatformTime::Seconds();
+    const double BudgetSec = EditDrainBudgetMs / 1000.0;
+
+    // One batch: every touched chunk is rebuilt once, whatever the number of edits this tick
+    FVoxelEditedCells CellsThisTick;
+    BeginEditBatch();
+    do
+    {
+        FQueuedEdit Queued = MoveTemp(EditQueue[EditQueueHead++]);
+        AVoxelPlayerController* Requester = Queued.Requester.Get();
+        if (!Requester) continue;   // left the game
+
+        switch (Requester->ApplyAdmittedEdit_Server(*this, Queued.Req, CellsThisTick))
+        {
+        case EVoxelEditOutcome::Applied:   ++EditStats.Applied; break;
+        case EVoxelEditOutcome::Duplicate: ++EditStats.Deduplicated; break;
+        case EVoxelEditOutcome::Invalid:   ++EditStats.Invalid; break;
+        default: break;
+        }
+    } while (EditQueueHead < EditQueue.Num() && (FPlatformTime::Seconds() - StartSec) < BudgetSec);
+    EndEditBatch();
+
+    // Compact once the consumed front dominates
+    if (EditQueueHead >= EditQueue.Num())
+    {
+        EditQueue.Reset();
+        EditQueueHead = 0;
     }
-    else if (LZ == CHUNK_SIZE_Z - 1) {
-        FChunkKey NK = ChunkKey; NK.Z += 1;
-        if (FChunkRecord* NRec = Loaded.Find(NK)) { OutChunksNeedingRebuild.Add(NK); KickBuild(NK, NRec->Data); }
+    else if (EditQueueHead > EditQueue.Num() / 2)
+    {
+        EditQueue.RemoveAt(0, EditQueueHead, EAllowShrinking::No);
+        EditQueueHead = 0;
     }
-    return true;
+    EditStats.QueueDepth = EditQueue.Num() - EditQueueHead;
 }
 
 void AVoxelWorldManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     FlushAllDirtyChunks();
+
+    if (IsValid(FarTerrain))
+    {
+        FarTerrain->Destroy();
+    }
+    FarTerrain = nullptr;
+
+    if (UVoxelWorldSubsystem* Registry = UVoxelWorldSubsystem::Get(GetWorld()))
+    {
+        Registry->UnregisterManager(this);
+    }
+
     Super::EndPlay(EndPlayReason);
 }
 
@@ -401,33 +815,152 @@ void AVoxelWorldManager::GatherCenters(TArray<FIntPoint>& OutCenters) const
 
 // ---------- build / spawn / unload ----------
 
-void AVoxelWorldManager::KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkData> Existing)
+void AVoxelWorldManager::KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkData> Existing, uint32 SectionMask)
 {
-    if (Pending.Contains(Key)) return;
+    FChunkRecord* Rec = Loaded.Find(Key);
+
+    if (Pending.Contains(Key))
+    {
+        // The in-flight build may have read the data before this change; rebuild these sections on drain.
+        if (Rec)
+        {
+            Rec->bDirty = true;
+            Rec->DirtySections |= SectionMask;
+        }
+        return;
+    }
     Pending.Add(Key);
 
+    // This build sees every edit made so far; anything after it re-flags the record.
+    if (Rec)
+    {
+        if (Rec->bDirty) SectionMask |= Rec->DirtySections;
+        Rec->bDirty = false;
+        Rec->DirtySections = 0;
+    }
+
+    // Partial builds only make sense on top of an existing mesh.
+    if (!Rec || !Rec->Actor.IsValid() || !Existing.IsValid())
+    {
+        SectionMask = CHUNK_ALL_SECTIONS;
+    }
+    SectionMask &= CHUNK_ALL_SECTIONS;
+
+    // Collision follows the render sections once the chunk has it; a chunk gaining it gets every slab.
+    uint32 CollisionMask = 0;
+    if (!bSkipChunkMeshing && WantsCollision(Key))
+    {
+        CollisionMask = (Rec && Rec->bHasCollision) ? SectionMask : CHUNK_ALL_SECTIONS;
+    }
+
+    // Snapshot neighbor border layers here (game thread) so the worker never reads live neighbor data.
+    FVoxelChunkBorders Borders;
+    CaptureBorders(Key, Borders);
+
     const int32 Seed = WorldSeed;
     const float BS = BlockSize;
     const FString WName = WorldName;
+    const bool bPacked = bUsePackedChunkRendering;
+    const bool bMesh = !bSkipChunkMeshing;
+
+    // Client visual: a chunk streaming back in starts from the edits it had when it left
+    int32 CachedSeq = INDEX_NONE;
+    TSharedPtr<TMap<int32, uint16>> CachedEdits;
+    if (!Existing.IsValid())
+    {
+        if (const FCachedChunkEdits* Cached = ClientEditCache.Find(Key))
+        {
+            CachedSeq = Cached->Seq;
+            CachedEdits = MakeShared<TMap<int32, uint16>>(Cached->ModifiedBlocks);
+            ClientEditCache.Remove(Key);
+        }
+    }
+
+    // Client visual streaming contents: the server's blocks replace generation (Tick only kicks once they're here)
+    TSharedPtr<const TArray<uint8>> StreamedContent;
+    if (!Existing.IsValid() && bClientVisualInstance && bStreamChunkContents && ConfirmedContents.Contains(Key))
+    {
+        if (const TSharedPtr<const TArray<uint8>>* Found = ContentCache.FindAndTouch(ChunkContentHashes.FindRef(Key)))
+        {
+            StreamedContent = *Found;
+        }
+    }
 
-    Async(EAsyncExecution::ThreadPool, [this, Key, Existing, Seed, BS, WName]()
+    Async(EAsyncExecution::ThreadPool, [this, Key, Existing, Seed, BS, WName, bPacked, bMesh, SectionMask, CollisionMask, CachedSeq, CachedEdits, StreamedContent, Borders = MoveTemp(Borders)]()
         {
             TSharedPtr<FVoxelChunkData> Data = Existing;
             if (!Data.IsValid())
             {
                 Data = MakeShared<FVoxelChunkData>(Key);
-                FVoxelGenerator Gen(Seed);
-                Gen.GenerateBaseChunk(Key, *Data);
+                bool bDecoded = false;
+                if (StreamedContent.IsValid())
+                {
+                    VOXEL_SCOPE(ContentDecode);
+                    bDecoded = VoxelDeltaCodec::DecodeBlocks(*StreamedContent, Data->Blocks);
+                    if (bDecoded)
+                    {
+                        // The generator fills the extents itself; decoded blocks come without them
+                        Data->RecomputeExtents();
+                    }
+                }
+                if (!bDecoded)
+                {
+                    if (StreamedContent.IsValid())
+                    {
+                        UE_LOG(LogTemp, Warning, TEXT("[VoxelNet] Bad streamed contents for chunk (%d,%d); generating it"), Key.X, Key.Z);
+                    }
+                    FVoxelGenerator Gen(Seed);
+                    Gen.GenerateBaseChunk(Key, *Data);
+                }
 
                 VoxelSaveSystem::LoadDeltaByWorld(WName, *Data);
+                if (CachedEdits.IsValid())
+                {
+                    Data->ModifiedBlocks = MoveTemp(*CachedEdits);
+                    Data->RecomputeExtents();
+                }
             }
 
             TSharedPtr<FChunkMeshResult> R = MakeShared<FChunkMeshResult>();
             R->Key = Key;
             R->BlockSize = BS;
             R->Data = Data;
+            R->NeighborMask = Borders.GetAvailableMask();
+            R->SectionMask = SectionMask;
+            R->bPacked = bPacked;
+            R->CollisionMask = CollisionMask;
+            R->CachedEditSeq = CachedSeq;
+
+            R->Sections.SetNum(CHUNK_NUM_SECTIONS);
+            R->CollisionSections.SetNum(CHUNK_NUM_SECTIONS);
+            if (bPacked)
+            {
+                R->PackedSections.SetNum(CHUNK_NUM_SECTIONS);
+                R->PackedVoxelBounds.Init(FBox(ForceInit), CHUNK_NUM_SECTIONS);
+            }
+
+            for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+            {
+                // Headless: sections stay empty, so the actor only keeps the bookkeeping
+                if (bMesh && (SectionMask & (1u << s)))
+                {
+                    VOXEL_SCOPE(MeshBuild);
+                    if (bPacked)
+                    {
+                        FVoxelMesher_Naive::BuildPackedMesh(*Data, R->PackedSections[s], R->PackedVoxelBounds[s], &Borders, s);
+                    }
+                    else
+                    {
+                        FVoxelMesher_Naive::BuildMeshSection(*Data, BS, R->Sections[s], &Borders, s);
+                    }
+                }
 
-            FVoxelMesher_Naive::BuildMesh(*Data, BS, R->V, R->I, R->N, R->UV, R->C, R->T);
+                if (CollisionMask & (1u << s))
+                {
+                    VOXEL_SCOPE(CollisionBuild);
+                    FVoxelMesher_Naive::BuildCollisionSection(*Data, BS, R->CollisionSections[s], &Borders, s);
+                }
+            }
 
             Completed.Enqueue(R);
         });
@@ -435,6 +968,7 @@ void AVoxelWorldManager::KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkD
 
 void AVoxelWorldManager::SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMeshResult>& Res)
 {
+    VOXEL_SCOPE(ActorSpawn);
     if (!Res) return;
     if (!IsWithinWorldLimit(Res->Key)) return;
 
@@ -444,14 +978,34 @@ void AVoxelWorldManager::SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMes
         Rec.Data = Res->Data.IsValid() ? Res->Data : MakeShared<FVoxelChunkData>(Res->Key);
     }
 
+    // Client visual: the sequence of any cached edits this build started from (deltas applied while it was
+    // loading are newer and win)
+    if (Res->CachedEditSeq != INDEX_NONE && !ClientDeltaSeq.Contains(Res->Key))
+    {
+        ClientDeltaSeq.Add(Res->Key, Res->CachedEditSeq);
+    }
+
     // Apply any pending replicated edits that arrived before this chunk finished loading
     bool bAppliedPending = false;
+    uint8 PendingBorderSides = 0;
+    uint32 PendingSections = 0;
+    if (PendingNetResets.Remove(Res->Key) > 0)
+    {
+        // A reset arrived while loading: the chunk holds exactly the server's set (queued below)
+        Rec.Data->ClearDeltas();
+        Rec.Data->RecomputeExtents();
+        PendingBorderSides = (1 << FVoxelChunkBorders::NumSides) - 1;
+        PendingSections = CHUNK_ALL_SECTIONS;
+        bAppliedPending = true;
+    }
     if (PendingNetDeltas.Contains(Res->Key))
     {
         TArray<FNetModifiedBlock>& Arr = PendingNetDeltas.FindChecked(Res->Key);
         for (const FNetModifiedBlock& B : Arr)
         {
             Rec.Data->SetBlockAt(B.X, B.Y, B.Z, (EBlockId)B.Id, /*bMarkModified*/true);
+            PendingBorderSides |= BorderSidesForCell(B.X, B.Z);
+            PendingSections |= FVoxelMesher_Naive::GetSectionMaskForCellY(B.Y);
         }
         Arr.Reset();
         PendingNetDeltas.Remove(Res->Key);
@@ -460,7 +1014,8 @@ void AVoxelWorldManager::SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMes
 
     // Spawn or fetch the visual actor
     AVoxelChunkActor* Actor = Rec.Actor.Get();
-    if (!Actor || !IsValid(Actor))
+    const bool bNewlyLoaded = !Actor || !IsValid(Actor);
+    if (bNewlyLoaded)
     {
         const FVector Origin(
             (double)Res->Key.X * CHUNK_SIZE_X * Res->BlockSize,
@@ -474,6 +1029,7 @@ void AVoxelWorldManager::SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMes
         Actor->BlockSize = Res->BlockSize;
         Actor->SetRenderMeshes(bRenderMeshes);
         Rec.Actor = Actor;
+        Rec.bHasCollision = false;
     }
     else
     {
@@ -484,36 +1040,50 @@ void AVoxelWorldManager::SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMes
     // Schedule a fresh build and skip drawing the stale mesh.
     if (bAppliedPending)
     {
+        // (the sections this result carried are rebuilt too, since they are not drawn)
         Rec.bDirty = false;               // we'll rebuild immediately
-        KickBuild(Res->Key, Rec.Data);
+        KickBuild(Res->Key, Rec.Data, bNewlyLoaded ? CHUNK_ALL_SECTIONS : (Res->SectionMask | PendingSections));
+        RemeshNeighbors(Res->Key, PendingBorderSides, PendingSections);
     }
     else
     {
-        // No pending edits: draw the buffers we just built
-        Actor->BuildFromBuffers(Res->V, Res->I, Res->N, Res->UV, Res->C, Res->T, ChunkMaterial);
-        Rec.bDirty = false;
-    }
+        // No pending edits: draw the buffers we just built. Built outside the collision radius: drop any
+        // collision the actor still has (nullptr + full mask).
+        TArray<FProcMeshSection>* Collision = Res->CollisionMask ? &Res->CollisionSections : nullptr;
+        const uint32 CollisionMask = Res->CollisionMask ? Res->CollisionMask : (Rec.bHasCollision ? CHUNK_ALL_SECTIONS : 0);
+        if (Res->bPacked)
+        {
+            Actor->BuildFromPacked(Res->PackedSections, Res->PackedVoxelBounds, Res->SectionMask, Collision, CollisionMask, ChunkMaterial);
+        }
+        else
+        {
+            Actor->BuildFromSections(Res->Sections, Res->SectionMask, ChunkMaterial, Collision, CollisionMask);
+        }
+        Rec.bHasCollision = (Res->CollisionMask != 0);
 
-    // === Server: ensure there is a net-state actor for this chunk ===
-    if (HasAuthority() && !bClientVisualInstance)
-    {
-        if (AVoxelChunkNetState* NS = GetOrCreateNetState_Server(Res->Key))
+        // Sections outside the mask were meshed against the previous neighbor set
+        const bool bWholeChunk = (Res->SectionMask == CHUNK_ALL_SECTIONS);
+        Rec.MeshedNeighborMask = bWholeChunk ? Res->NeighborMask : (Rec.MeshedNeighborMask & Res->NeighborMask);
+
+        // Partial result for an actor that had to be respawned: fill in the rest
+        if (bNewlyLoaded && !bWholeChunk)
         {
-            const FVector Origin(
-                (double)Res->Key.X * CHUNK_SIZE_X * Res->BlockSize,
-                (double)Res->Key.Z * CHUNK_SIZE_Z * Res->BlockSize,
-                0.0
-            );
-            NS->SetActorLocation(Origin);
+            KickBuild(Res->Key, Rec.Data, CHUNK_ALL_SECTIONS & ~Res->SectionMask);
         }
     }
 
+    // Full-resolution mesh is up: the far mesh for this key (if any) steps aside
+    SetLODChunkHidden(Res->Key, true);
+
+    // Border faces depend on neighbors: catch up with any that loaded while this build was in flight
+    RefreshNeighborBorders(Res->Key, bNewlyLoaded);
+
     // === Client visual: defensive  apply any super-late ops
     if (bClientVisualInstance)
     {
         ApplyPendingOpsForChunk(Res->Key);
 
-        // NEW: ask the server for an authoritative snapshot of THIS chunk once
+        // Subscribe to THIS chunk's delta stream once, from whatever we already hold of it
         if (!SnapshotRequestedOnce.Contains(Res->Key))
         {
             SnapshotRequestedOnce.Add(Res->Key);
@@ -522,36 +1092,456 @@ void AVoxelWorldManager::SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMes
             {
                 if (AVoxelPlayerController* VPC = Cast<AVoxelPlayerController>(PC))
                 {
-                    // Radius 0 = just this chunk; bump to 1 if you want neighbors too
-                    VPC->Server_RequestChunkSnapshotsForArea(FIntPoint(Res->Key.X, Res->Key.Z), /*Radius=*/0);
+                    VPC->Server_RequestChunkDeltas(GetClientChunkVersion(FIntPoint(Res->Key.X, Res->Key.Z)));
                 }
             }
         }
     }
 }
 
-void AVoxelWorldManager::UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired)
+void AVoxelWorldManager::CaptureBorders(const FChunkKey& Key, FVoxelChunkBorders& OutBorders) const
 {
-    TArray<FChunkKey> ToUnload;
-    ToUnload.Reserve(Loaded.Num());
-
-    auto WithinUnloadPad = [this](const FChunkKey& TestKey)->bool
+    OutBorders.bMissingIsSolid = (MissingNeighborPolicy == EVoxelMissingNeighborPolicy::CullFaces);
+    for (int32 Side = 0; Side < FVoxelChunkBorders::NumSides; ++Side)
+    {
+        const FChunkRecord* NRec = Loaded.Find(FVoxelChunkBorders::GetNeighborKey(Key, Side));
+        if (NRec && NRec->Data.IsValid())
         {
-            TArray<FIntPoint> Centers;
-            GatherCenters(Centers);
-            if (Centers.Num() == 0) return false;
+            OutBorders.CaptureSide(Side, *NRec->Data);
+        }
+    }
+}
 
-            const int32 Pad = 1;
-            for (const FIntPoint& C : Centers)
-            {
-                if (FMath::Abs(TestKey.X - C.X) <= (RenderRadiusChunks + Pad) &&
-                    FMath::Abs(TestKey.Z - C.Y) <= (RenderRadiusChunks + Pad))
-                {
-                    return true;
-                }
-            }
-            return false;
-        };
+// ---------- collision radius ----------
+
+void AVoxelWorldManager::UpdateCollisionCenters(const TArray<FIntPoint>& Centers)
+{
+    // Streaming centers plus every pawn (players and AI) that may stand on or run into chunks
+    CollisionCenters = Centers;
+    for (TActorIterator<APawn> It(GetWorld()); It; ++It)
+    {
+        CollisionCenters.AddUnique(WorldToChunkXZ(It->GetActorLocation()));
+    }
+}
+
+bool AVoxelWorldManager::WantsCollision(const FChunkKey& Key, int32 Pad) const
+{
+    if (CollisionRadiusChunks < 0) return true;
+
+    const int32 R = CollisionRadiusChunks + Pad;
+    for (const FIntPoint& C : CollisionCenters)
+    {
+        if (FMath::Abs(Key.X - C.X) <= R && FMath::Abs(Key.Z - C.Y) <= R)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AVoxelWorldManager::KickCollisionBuild(const FChunkKey& Key)
+{
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Data.IsValid() || Pending.Contains(Key)) return;
+    Pending.Add(Key);
+
+    FVoxelChunkBorders Borders;
+    CaptureBorders(Key, Borders);
+
+    TSharedPtr<FVoxelChunkData> Data = Rec->Data;
+    const float BS = BlockSize;
+
+    Async(EAsyncExecution::ThreadPool, [this, Key, Data, BS, Borders = MoveTemp(Borders)]()
+        {
+            TSharedPtr<FChunkMeshResult> R = MakeShared<FChunkMeshResult>();
+            R->Key = Key;
+            R->BlockSize = BS;
+            R->Data = Data;
+            R->SectionMask = 0;
+            R->bCollisionOnly = true;
+            R->CollisionMask = CHUNK_ALL_SECTIONS;
+
+            R->CollisionSections.SetNum(CHUNK_NUM_SECTIONS);
+            {
+                VOXEL_SCOPE(CollisionBuild);
+                for (int32 s = 0; s < CHUNK_NUM_SECTIONS; ++s)
+                {
+                    FVoxelMesher_Naive::BuildCollisionSection(*Data, BS, R->CollisionSections[s], &Borders, s);
+                }
+            }
+
+            Completed.Enqueue(R);
+        });
+}
+
+void AVoxelWorldManager::ApplyCollisionResult(const TSharedPtr<FChunkMeshResult>& Res)
+{
+    VOXEL_SCOPE(CollisionCook);
+    FChunkRecord* Rec = Loaded.Find(Res->Key);
+    AVoxelChunkActor* Actor = Rec ? Rec->Actor.Get() : nullptr;
+    if (!Actor || !IsValid(Actor)) return; // unloaded while building
+
+    // Pawns moved away while this was in flight
+    if (!WantsCollision(Res->Key, /*Pad*/1)) return;
+
+    Actor->SetCollisionSections(Res->CollisionSections, Res->CollisionMask);
+    Rec->bHasCollision = true;
+}
+
+void AVoxelWorldManager::UpdateCollisionRadius(int32& InOutEnqueueBudget)
+{
+    if (bSkipChunkMeshing) return;
+
+    for (TPair<FChunkKey, FChunkRecord>& Pair : Loaded)
+    {
+        FChunkRecord& Rec = Pair.Value;
+        AVoxelChunkActor* Actor = Rec.Actor.Get();
+        if (!Actor || !IsValid(Actor)) continue;
+
+        if (Rec.bHasCollision)
+        {
+            // One chunk of hysteresis so a pawn on a chunk edge doesn't toggle its neighbors every update
+            if (!WantsCollision(Pair.Key, /*Pad*/1))
+            {
+                Actor->ClearCollision();
+                Rec.bHasCollision = false;
+            }
+        }
+        else if (InOutEnqueueBudget > 0 && !Pending.Contains(Pair.Key) && WantsCollision(Pair.Key))
+        {
+            KickCollisionBuild(Pair.Key);
+            --InOutEnqueueBudget;
+        }
+    }
+}
+
+// ---------- far LOD chunks ----------
+
+bool AVoxelWorldManager::IsLODActive() const
+{
+    // Purely visual: nothing to gain on a dedicated server or a manager that doesn't render.
+    return bEnableLOD && bRenderMeshes && GetNetMode() != NM_DedicatedServer;
+}
+
+int32 AVoxelWorldManager::GetLODForDistance(int32 Distance) const
+{
+    if (Distance <= RenderRadiusChunks) return 0;
+
+    const int32 NumRings = FMath::Min(LODRingRadiiChunks.Num(), VOXEL_MAX_LOD);
+    for (int32 i = 0; i < NumRings; ++i)
+    {
+        if (Distance <= LODRingRadiiChunks[i]) return i + 1;
+    }
+    return 0;
+}
+
+void AVoxelWorldManager::KickLODBuild(const FChunkKey& Key, int32 LOD)
+{
+    if (LODPending.Contains(Key)) return;
+    LODPending.Add(Key);
+
+    // Reuse resident data (keeps edits exact); otherwise generate + deltas on the worker and drop it afterwards.
+    const FChunkRecord* Rec = Loaded.Find(Key);
+    TSharedPtr<FVoxelChunkData> Existing = Rec ? Rec->Data : nullptr;
+
+    const int32 Seed = WorldSeed;
+    const float BS = BlockSize;
+    const FString WName = WorldName;
+    const bool bPacked = bUsePackedChunkRendering;
+
+    Async(EAsyncExecution::ThreadPool, [this, Key, LOD, Existing, Seed, BS, WName, bPacked]()
+        {
+            TSharedPtr<FVoxelChunkData> Data = Existing;
+            if (!Data.IsValid())
+            {
+                Data = MakeShared<FVoxelChunkData>(Key);
+                FVoxelGenerator Gen(Seed);
+                Gen.GenerateBaseChunk(Key, *Data);
+
+                VoxelSaveSystem::LoadDeltaByWorld(WName, *Data);
+            }
+
+            TSharedPtr<FChunkMeshResult> R = MakeShared<FChunkMeshResult>();
+            R->Key = Key;
+            R->BlockSize = BS;
+            R->LOD = LOD;
+            R->SectionMask = 1u;
+            R->bPacked = bPacked;
+
+            R->Sections.SetNum(1);
+            {
+                VOXEL_SCOPE(MeshBuild);
+                if (bPacked)
+                {
+                    R->PackedSections.SetNum(1);
+                    R->PackedVoxelBounds.Init(FBox(ForceInit), 1);
+                    FVoxelMesher_Naive::BuildLODPackedMesh(*Data, LOD, R->PackedSections[0], R->PackedVoxelBounds[0]);
+                }
+                else
+                {
+                    FVoxelMesher_Naive::BuildLODMeshSection(*Data, BS, LOD, R->Sections[0]);
+                }
+            }
+
+            Completed.Enqueue(R);
+        });
+}
+
+void AVoxelWorldManager::SpawnOrUpdateLODChunkFromResult(const TSharedPtr<FChunkMeshResult>& Res)
+{
+    // Retired while building: drop the result
+    FLODChunkRecord* LRec = LODLoaded.Find(Res->Key);
+    if (!LRec) return;
+
+    AVoxelChunkActor* Actor = LRec->Actor.Get();
+    if (!Actor || !IsValid(Actor))
+    {
+        const FVector Origin(
+            (double)Res->Key.X * CHUNK_SIZE_X * Res->BlockSize,
+            (double)Res->Key.Z * CHUNK_SIZE_Z * Res->BlockSize,
+            0.0
+        );
+        FActorSpawnParameters SP;
+        SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        Actor = GetWorld()->SpawnActor<AVoxelChunkActor>(Origin, FRotator::ZeroRotator, SP);
+        if (!Actor) return;
+        Actor->BlockSize = Res->BlockSize;
+        Actor->SetRenderMeshes(bRenderMeshes);
+        LRec->Actor = Actor;
+    }
+
+    Actor->BuildFromLOD(Res->Sections, Res->PackedSections, Res->PackedVoxelBounds, Res->bPacked, ChunkMaterial);
+    LRec->LOD = Res->LOD;
+
+    // Hidden while the full-resolution chunk is up
+    const FChunkRecord* Rec = Loaded.Find(Res->Key);
+    Actor->SetActorHiddenInGame(Rec && Rec->Actor.IsValid());
+
+    // The rings moved on while this was building
+    if (LRec->DesiredLOD > 0 && LRec->DesiredLOD != LRec->LOD)
+    {
+        KickLODBuild(Res->Key, LRec->DesiredLOD);
+    }
+}
+
+void AVoxelWorldManager::UpdateFarTerrain(const TArray<FIntPoint>& Centers)
+{
+    // Same visual-only rule as the LOD rings
+    const bool bWanted = bEnableFarTerrain && bRenderMeshes && GetNetMode() != NM_DedicatedServer && Centers.Num() > 0;
+    if (!bWanted)
+    {
+        if (IsValid(FarTerrain))
+        {
+            FarTerrain->Destroy();
+        }
+        FarTerrain = nullptr;
+        return;
+    }
+
+    if (!IsValid(FarTerrain))
+    {
+        FActorSpawnParameters SP;
+        SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        FarTerrain = GetWorld()->SpawnActor<AVoxelFarTerrainActor>(FVector::ZeroVector, FRotator::ZeroRotator, SP);
+        if (!FarTerrain) return;
+
+        FarTerrain->BlockSize = BlockSize;
+        FarTerrain->WorldSeed = WorldSeed;
+        FarTerrain->WorldLimitChunks = GetWorldRadiusLimit();
+        FarTerrain->SetMaterial(ChunkMaterial);
+    }
+
+    // Starts where voxel geometry ends: the last LOD ring, or the full-resolution radius
+    int32 Inner = RenderRadiusChunks;
+    if (IsLODActive())
+    {
+        for (int32 i = 0; i < FMath::Min(LODRingRadiiChunks.Num(), VOXEL_MAX_LOD); ++i)
+        {
+            Inner = FMath::Max(Inner, LODRingRadiiChunks[i]);
+        }
+    }
+
+    // The horizon is a view-space effect: follow the first (local) center
+    FarTerrain->UpdateCenter(Centers[0], Inner, FarTerrainRadiusChunks);
+}
+
+void AVoxelWorldManager::SetLODChunkHidden(const FChunkKey& Key, bool bHidden)
+{
+    if (FLODChunkRecord* LRec = LODLoaded.Find(Key))
+    {
+        if (AVoxelChunkActor* A = LRec->Actor.Get())
+        {
+            A->SetActorHiddenInGame(bHidden);
+        }
+    }
+}
+
+void AVoxelWorldManager::UpdateLODRings(const TArray<FIntPoint>& Centers, int32& InOutEnqueueBudget)
+{
+    // Desired level per key: nearest center wins
+    int32 Outer = 0;
+    for (int32 i = 0; i < FMath::Min(LODRingRadiiChunks.Num(), VOXEL_MAX_LOD); ++i)
+    {
+        Outer = FMath::Max(Outer, LODRingRadiiChunks[i]);
+    }
+
+    TMap<FChunkKey, int32> DesiredLOD;
+    TMap<FChunkKey, int32> DesiredDist;
+    for (const FIntPoint& C : Centers)
+    {
+        for (int32 dz = -Outer; dz <= Outer; ++dz)
+        {
+            for (int32 dx = -Outer; dx <= Outer; ++dx)
+            {
+                const int32 Dist = FMath::Max(FMath::Abs(dx), FMath::Abs(dz));
+                const FChunkKey Key(C.X + dx, C.Y + dz);
+                if (!IsWithinWorldLimit(Key)) continue;
+
+                int32& BestDist = DesiredDist.FindOrAdd(Key, MAX_int32);
+                if (Dist < BestDist)
+                {
+                    BestDist = Dist;
+                    DesiredLOD.Add(Key, GetLODForDistance(Dist));
+                }
+            }
+        }
+    }
+
+    // Retire far meshes that left the rings. Keys that moved inside RenderRadiusChunks keep theirs
+    // until the full-resolution chunk is on screen, so there is never a hole during the swap.
+    TArray<FChunkKey> ToRemove;
+    for (TPair<FChunkKey, FLODChunkRecord>& Pair : LODLoaded)
+    {
+        const int32* Want = DesiredLOD.Find(Pair.Key);
+        const int32 Level = Want ? *Want : 0;
+        Pair.Value.DesiredLOD = Level;
+        if (Level > 0) continue;
+
+        const bool bInsideFullRadius = DesiredDist.Contains(Pair.Key) && DesiredDist[Pair.Key] <= RenderRadiusChunks;
+        const FChunkRecord* Rec = Loaded.Find(Pair.Key);
+        if (bInsideFullRadius && !(Rec && Rec->Actor.IsValid())) continue;
+
+        if (AVoxelChunkActor* A = Pair.Value.Actor.Get())
+        {
+            A->Destroy();
+        }
+        ToRemove.Add(Pair.Key);
+    }
+    for (const FChunkKey& K : ToRemove)
+    {
+        LODLoaded.Remove(K);
+    }
+
+    // Queue new far chunks and level changes, nearest first
+    TArray<FChunkKey> Work;
+    for (const TPair<FChunkKey, int32>& Pair : DesiredLOD)
+    {
+        if (Pair.Value <= 0) continue;
+        if (LODPending.Contains(Pair.Key)) continue;
+
+        const FLODChunkRecord* LRec = LODLoaded.Find(Pair.Key);
+        if (LRec && LRec->LOD == Pair.Value) continue;
+
+        Work.Add(Pair.Key);
+    }
+    Work.Sort([&DesiredDist](const FChunkKey& A, const FChunkKey& B)
+        {
+            return DesiredDist[A] < DesiredDist[B];
+        });
+
+    for (const FChunkKey& K : Work)
+    {
+        if (InOutEnqueueBudget <= 0) break;
+
+        FLODChunkRecord& LRec = LODLoaded.FindOrAdd(K);
+        LRec.DesiredLOD = DesiredLOD[K];
+        KickLODBuild(K, LRec.DesiredLOD);
+        --InOutEnqueueBudget;
+    }
+}
+
+void AVoxelWorldManager::RequestRemesh(const FChunkKey& Key, uint32 SectionMask)
+{
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Data.IsValid()) return;
+
+    // If a build is in flight, KickBuild records the sections and the drain rebuilds them.
+    KickBuild(Key, Rec->Data, SectionMask);
+}
+
+void AVoxelWorldManager::RefreshNeighborBorders(const FChunkKey& Key, bool bNewlyLoaded)
+{
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec) return;
+
+    for (int32 Side = 0; Side < FVoxelChunkBorders::NumSides; ++Side)
+    {
+        const FChunkKey NK = FVoxelChunkBorders::GetNeighborKey(Key, Side);
+        FChunkRecord* NRec = Loaded.Find(NK);
+        if (!NRec || !NRec->Data.IsValid()) continue;
+
+        // This chunk was meshed before that neighbor was available (a build in flight already sees it)
+        if (!(Rec->MeshedNeighborMask & (1 << Side)) && !Pending.Contains(Key))
+        {
+            Rec->bDirty = true;
+            Rec->DirtySections = CHUNK_ALL_SECTIONS;
+        }
+
+        // The neighbor was meshed before this chunk was available
+        const int32 Back = FVoxelChunkBorders::Opposite(Side);
+        if (bNewlyLoaded && NRec->Actor.IsValid() && !(NRec->MeshedNeighborMask & (1 << Back)))
+        {
+            RequestRemesh(NK);
+        }
+    }
+}
+
+uint8 AVoxelWorldManager::BorderSidesForCell(int32 LX, int32 LZ)
+{
+    uint8 Mask = 0;
+    if (LX == 0)                Mask |= (1 << FVoxelChunkBorders::NegX);
+    if (LX == CHUNK_SIZE_X - 1) Mask |= (1 << FVoxelChunkBorders::PosX);
+    if (LZ == 0)                Mask |= (1 << FVoxelChunkBorders::NegZ);
+    if (LZ == CHUNK_SIZE_Z - 1) Mask |= (1 << FVoxelChunkBorders::PosZ);
+    return Mask;
+}
+
+void AVoxelWorldManager::RemeshNeighbors(const FChunkKey& Key, uint8 SideMask, uint32 SectionMask, TArray<FChunkKey>* OutRebuilt)
+{
+    for (int32 Side = 0; Side < FVoxelChunkBorders::NumSides; ++Side)
+    {
+        if (!(SideMask & (1 << Side))) continue;
+
+        const FChunkKey NK = FVoxelChunkBorders::GetNeighborKey(Key, Side);
+        if (!Loaded.Contains(NK)) continue;
+
+        if (OutRebuilt) OutRebuilt->Add(NK);
+        RequestRemesh(NK, SectionMask);
+    }
+}
+
+void AVoxelWorldManager::UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired)
+{
+    TArray<FChunkKey> ToUnload;
+    ToUnload.Reserve(Loaded.Num());
+
+    auto WithinUnloadPad = [this](const FChunkKey& TestKey)->bool
+        {
+            TArray<FIntPoint> Centers;
+            GatherCenters(Centers);
+            if (Centers.Num() == 0) return false;
+
+            const int32 Pad = 1;
+            for (const FIntPoint& C : Centers)
+            {
+                if (FMath::Abs(TestKey.X - C.X) <= (RenderRadiusChunks + Pad) &&
+                    FMath::Abs(TestKey.Z - C.Y) <= (RenderRadiusChunks + Pad))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
 
     for (auto& Pair : Loaded)
     {
@@ -560,12 +1550,19 @@ void AVoxelWorldManager::UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired)
 
         if (!Desired.Contains(ThisKey) && !WithinUnloadPad(ThisKey))
         {
-            // Despawn actor if present
+            // Despawn actor if present (a far LOD mesh, if already built for this key, takes over)
             if (AVoxelChunkActor* A = Rec.Actor.Get())
             {
                 A->Destroy();
                 Rec.Actor = nullptr;
             }
+            SetLODChunkHidden(ThisKey, false);
+
+            // Client visual: unanswered predictions leave with the chunk (saves and the edit cache get server values)
+            if (bClientVisualInstance && Rec.Data.IsValid())
+            {
+                DropPredictionsForChunk_Client(ThisKey, *Rec.Data);
+            }
 
             // Off-thread save of modified blocks (authoritative only)
             if (HasAuthority() && Rec.Data.IsValid() && Rec.Data->ModifiedBlocks.Num() > 0)
@@ -582,10 +1579,24 @@ void AVoxelWorldManager::UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired)
 
             ToUnload.Add(ThisKey);
 
-            // Tear down net-state on server
+            // Client visual: keep the edits (small) so streaming back in only needs what changed since
+            if (bClientVisualInstance && ClientEditCache.Max() > 0 && Rec.Data.IsValid() && Rec.Data->ModifiedBlocks.Num() > 0)
+            {
+                // Full: the chunk unloaded longest ago is evicted (entries leave when their chunk streams back in)
+                FCachedChunkEdits Cached;
+                Cached.Seq = ClientDeltaSeq.FindRef(ThisKey);
+                Cached.ModifiedBlocks = Rec.Data->ModifiedBlocks;
+                ClientEditCache.Add(ThisKey, MoveTemp(Cached));
+            }
+
+            // Server: the delta log keeps only its sequence
             if (HasAuthority() && !bClientVisualInstance)
             {
-                DestroyNetState_Server(ThisKey);
+                if (FChunkDeltaLog* Log = DeltaLogs.Find(ThisKey))
+                {
+                    Log->BaseSeq = Log->HeadSeq;
+                    Log->Recent.Empty();
+                }
             }
         }
     }
@@ -595,6 +1606,25 @@ void AVoxelWorldManager::UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired)
         Loaded.Remove(K);
         Pending.Remove(K);
     }
+
+    // Client visual: the server stops sending edits for these; a snapshot is asked for again if they come back
+    if (bClientVisualInstance && ToUnload.Num() > 0)
+    {
+        TArray<FIntPoint> Unloaded;
+        Unloaded.Reserve(ToUnload.Num());
+        for (const FChunkKey& K : ToUnload)
+        {
+            SnapshotRequestedOnce.Remove(K);
+            ClientDeltaSeq.Remove(K);
+            PendingNetResets.Remove(K);
+            Unloaded.Add(FIntPoint(K.X, K.Z));
+        }
+
+        if (AVoxelPlayerController* VPC = Cast<AVoxelPlayerController>(UGameplayStatics::GetPlayerController(GetWorld(), 0)))
+        {
+            VPC->Server_ReportChunksUnloaded(Unloaded);
+        }
+    }
 }
 
 
@@ -606,15 +1636,21 @@ void AVoxelWorldManager::ApplyPendingOpsForChunk(const FChunkKey& Key)
     if (!Rec || !Rec->Data.IsValid()) return;
 
     TArray<FNetModifiedBlock>& Ops = PendingNetDeltas.FindChecked(Key);
+    uint8 BorderSides = 0;
+    uint32 Sections = 0;
     for (const FNetModifiedBlock& B : Ops)
     {
         Rec->Data->SetBlockAt(B.X, B.Y, B.Z, (EBlockId)B.Id, true);
+        BorderSides |= BorderSidesForCell(B.X, B.Z);
+        Sections |= FVoxelMesher_Naive::GetSectionMaskForCellY(B.Y);
     }
     Ops.Reset();
     PendingNetDeltas.Remove(Key);
+    if (Sections == 0) return;
 
     Rec->bDirty = true;
-    KickBuild(Key, Rec->Data);
+    KickBuild(Key, Rec->Data, Sections);
+    RemeshNeighbors(Key, BorderSides, Sections);
 }
 
 void AVoxelWorldManager::ApplyVisualOpOrQueue(FIntPoint ChunkXZ, int32 LocalIndex, int32 NewBlockId)
@@ -633,8 +1669,10 @@ void AVoxelWorldManager::ApplyVisualOpOrQueue(FIntPoint ChunkXZ, int32 LocalInde
     }
 
     Rec->Data->SetBlockAt(LX, LY, LZ, static_cast<EBlockId>(FMath::Clamp(NewBlockId, 0, 255)), true);
+    const uint32 Sections = FVoxelMesher_Naive::GetSectionMaskForCellY(LY);
     Rec->bDirty = true;
-    KickBuild(ChunkKeyLocal, Rec->Data);
+    KickBuild(ChunkKeyLocal, Rec->Data, Sections);
+    RemeshNeighbors(ChunkKeyLocal, BorderSidesForCell(LX, LZ), Sections);
 }
 
 bool AVoxelWorldManager::GetChunkModifiedOps_Server(const FChunkKey& Key, TArray<FBlockEditOp>& OutOps)
@@ -659,50 +1697,517 @@ bool AVoxelWorldManager::GetChunkModifiedOps_Server(const FChunkKey& Key, TArray
     return true;
 }
 
+AVoxelWorldManager::FChunkDeltaLog& AVoxelWorldManager::GetDeltaLog_Server(const FChunkKey& Key, const FVoxelChunkData& Data)
+{
+    if (FChunkDeltaLog* Found = DeltaLogs.Find(Key))
+    {
+        return *Found;
+    }
+
+    FChunkDeltaLog& Log = DeltaLogs.Add(Key);
+    Log.BaseSeq = Log.HeadSeq = (Data.ModifiedBlocks.Num() > 0) ? 1 : 0;
+    return Log;
+}
+
+bool AVoxelWorldManager::BuildChunkDelta_Server(const FChunkKey& Key, const FVoxelChunkVersion& Version, FVoxelChunkDelta& OutDelta)
+{
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Data.IsValid())
+    {
+        if (!EnsureChunkDataLoaded_ForEdit(Key, Rec))
+            return false;
+    }
+
+    const FChunkDeltaLog& Log = GetDeltaLog_Server(Key, *Rec->Data);
+    const int32 AckedSeq = Version.Seq;
+    if (AckedSeq > 0 && AckedSeq == Log.HeadSeq) return false;
+
+    OutDelta.ChunkXZ = FIntPoint(Key.X, Key.Z);
+    OutDelta.ToSeq = Log.HeadSeq;
+    OutDelta.Ops.Reset();
+
+    // Sequence 0 only says "never synced": the client may still hold edits (its own saves), so it isn't
+    // necessarily at the generated state and the log can't be replayed onto it
+    if (AckedSeq > 0 && AckedSeq >= Log.BaseSeq && AckedSeq < Log.HeadSeq)
+    {
+        // Catch up from the log
+        OutDelta.FromSeq = AckedSeq;
+        OutDelta.bReset = false;
+        OutDelta.Ops.Append(Log.Recent.GetData() + (AckedSeq - Log.BaseSeq), Log.HeadSeq - AckedSeq);
+        return true;
+    }
+
+    // Same content as ours (e.g. the log was trimmed past it, or its saves match): only the sequence moves
+    const uint32 ServerHash = Rec->Data->ComputeModifiedHash();
+    if (Version.Hash == ServerHash)
+    {
+        if (AckedSeq == Log.HeadSeq) return false;
+        OutDelta.FromSeq = AckedSeq;
+        OutDelta.bReset = false;
+        return true;
+    }
+
+    // Too far behind (or ahead: an older server session) with different content: send the whole modified set
+    OutDelta.FromSeq = 0;
+    OutDelta.bReset = true;
+    OutDelta.Ops.Reserve(Rec->Data->ModifiedBlocks.Num());
+    for (const TPair<int32, uint16>& Pair : Rec->Data->ModifiedBlocks)
+    {
+        FVoxelCellOp& Op = OutDelta.Ops.AddDefaulted_GetRef();
+        Op.LocalIndex = Pair.Key;
+        Op.BlockId = (uint8)Pair.Value;
+    }
+    return true;
+}
+
+bool AVoxelWorldManager::ApplyChunkDelta(const FVoxelChunkDelta& Delta)
+{
+    const FChunkKey Key(Delta.ChunkXZ.X, Delta.ChunkXZ.Y);
+
+    // Sent before the server heard we unloaded it
+    if (!Loaded.Contains(Key) && !Pending.Contains(Key)) return true;
+
+    int32& Seq = ClientDeltaSeq.FindOrAdd(Key);
+
+    if (!Delta.bReset)
+    {
+        if (Delta.ToSeq <= Seq) return true;     // already have all of it
+        if (Delta.FromSeq > Seq) return false;   // missed ops in between
+        // Overlapping ranges are fine: Ops are the latest values as of ToSeq
+    }
+
+    TArray<FBlockEditOp> Ops;
+    Ops.Reserve(Delta.Ops.Num());
+    for (const FVoxelCellOp& C : Delta.Ops)
+    {
+        FBlockEditOp& Op = Ops.AddDefaulted_GetRef();
+        Op.ChunkXZ = Delta.ChunkXZ;
+        Op.LocalIndex = C.LocalIndex;
+        Op.NewBlockId = C.BlockId;
+    }
+
+    if (Delta.bReset)
+    {
+        // Anything edited here but absent from the set goes back to its generated value
+        PendingNetDeltas.Remove(Key);
+        FChunkRecord* Rec = Loaded.Find(Key);
+        if (!Rec || !Rec->Data.IsValid())
+        {
+            PendingNetResets.Add(Key);
+        }
+        else
+        {
+            TSet<int32> InSet;
+            InSet.Reserve(Delta.Ops.Num());
+            for (const FVoxelCellOp& C : Delta.Ops) InSet.Add(C.LocalIndex);
+
+            for (const TPair<int32, uint16>& Pair : Rec->Data->ModifiedBlocks)
+            {
+                if (InSet.Contains(Pair.Key)) continue;
+                FBlockEditOp& Op = Ops.AddDefaulted_GetRef();
+                Op.ChunkXZ = Delta.ChunkXZ;
+                Op.LocalIndex = Pair.Key;
+                Op.NewBlockId = Rec->Data->Blocks[Pair.Key];
+            }
+
+            // Predicted cells the server doesn't list are at their generated value there
+            if (TMap<int32, FPredictedCell>* Predicted = PredictedCells.Find(Key))
+            {
+                for (TPair<int32, FPredictedCell>& Pair : *Predicted)
+                {
+                    if (!InSet.Contains(Pair.Key)) Pair.Value.ConfirmedId = Rec->Data->Blocks[Pair.Key];
+                }
+            }
+        }
+    }
+
+    // Cells showing a prediction keep it; the server's value waits underneath until the prediction settles
+    if (TMap<int32, FPredictedCell>* Predicted = PredictedCells.Find(Key))
+    {
+        Ops.RemoveAll([Predicted](const FBlockEditOp& Op)
+            {
+                FPredictedCell* Cell = Predicted->Find(Op.LocalIndex);
+                if (!Cell) return false;
+                Cell->ConfirmedId = (uint8)Op.NewBlockId;
+                return true;
+            });
+    }
+
+    Seq = Delta.ToSeq;
+    if (Ops.Num() > 0)
+    {
+        ApplyOrQueueClientOps(Delta.ChunkXZ, Ops);
+    }
+
+    // Predictions the server accepted at or below this sequence are now backed by real data
+    if (PendingPredictions.Num() > 0)
+    {
+        TArray<int32> Reached;
+        for (const TPair<int32, FPendingPrediction>& Pair : PendingPredictions)
+        {
+            if (Pair.Value.Key == Key && Pair.Value.ConfirmSeq > 0 && Pair.Value.ConfirmSeq <= Seq) Reached.Add(Pair.Key);
+        }
+        for (const int32 PredictionId : Reached)
+        {
+            SettlePrediction_Client(PredictionId);
+        }
+    }
+    return true;
+}
+
+bool AVoxelWorldManager::PredictBlockEdit(const FIntPoint& ChunkXZ, int32 LocalIndex, uint8 BlockId, int32 PredictionId)
+{
+    const FChunkKey Key(ChunkXZ.X, ChunkXZ.Y);
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Data.IsValid() || LocalIndex < 0 || LocalIndex >= CHUNK_VOLUME) return false;
+
+    int32 LX = 0, LY = 0, LZ = 0;
+    XYZFromIndex(LocalIndex, LX, LY, LZ);
+
+    TMap<int32, FPredictedCell>& Cells = PredictedCells.FindOrAdd(Key);
+    FPredictedCell* Cell = Cells.Find(LocalIndex);
+    if (!Cell)
+    {
+        // First prediction on this cell: what it shows now is the server's value
+        Cell = &Cells.Add(LocalIndex);
+        Cell->ConfirmedId = (uint8)Rec->Data->GetBlockAt(LX, LY, LZ);
+    }
+    Cell->PredictionId = PredictionId;
+
+    FPendingPrediction& Pending = PendingPredictions.Add(PredictionId);
+    Pending.Key = Key;
+    Pending.LocalIndex = LocalIndex;
+
+    TArray<FBlockEditOp> Ops;
+    FBlockEditOp& Op = Ops.AddDefaulted_GetRef();
+    Op.ChunkXZ = ChunkXZ;
+    Op.LocalIndex = LocalIndex;
+    Op.NewBlockId = BlockId;
+    ApplyOrQueueClientOps(ChunkXZ, Ops);
+    return true;
+}
+
+void AVoxelWorldManager::ResolvePrediction(int32 PredictionId, int32 Seq)
+{
+    FPendingPrediction* Pending = PendingPredictions.Find(PredictionId);
+    if (!Pending) return;   // its chunk unloaded meanwhile
+
+    // Rejected, or the delta carrying it is already applied
+    if (Seq <= 0 || ClientDeltaSeq.FindRef(Pending->Key) >= Seq)
+    {
+        SettlePrediction_Client(PredictionId);
+        return;
+    }
+    Pending->ConfirmSeq = Seq;
+}
+
+void AVoxelWorldManager::SettlePrediction_Client(int32 PredictionId)
+{
+    FPendingPrediction Pending;
+    if (!PendingPredictions.RemoveAndCopyValue(PredictionId, Pending)) return;
+
+    TMap<int32, FPredictedCell>* Cells = PredictedCells.Find(Pending.Key);
+    FPredictedCell* Cell = Cells ? Cells->Find(Pending.LocalIndex) : nullptr;
+    if (!Cell || Cell->PredictionId != PredictionId) return;   // a newer prediction owns the cell
+
+    const uint8 Confirmed = Cell->ConfirmedId;
+    Cells->Remove(Pending.LocalIndex);
+    if (Cells->Num() == 0) PredictedCells.Remove(Pending.Key);
+
+    FChunkRecord* Rec = Loaded.Find(Pending.Key);
+    if (!Rec || !Rec->Data.IsValid()) return;
+
+    int32 LX = 0, LY = 0, LZ = 0;
+    XYZFromIndex(Pending.LocalIndex, LX, LY, LZ);
+    if ((uint8)Rec->Data->GetBlockAt(LX, LY, LZ) == Confirmed) return;   // predicted right
+
+    TArray<FBlockEditOp> Ops;
+    FBlockEditOp& Op = Ops.AddDefaulted_GetRef();
+    Op.ChunkXZ = FIntPoint(Pending.Key.X, Pending.Key.Z);
+    Op.LocalIndex = Pending.LocalIndex;
+    Op.NewBlockId = Confirmed;
+    ApplyOrQueueClientOps(Op.ChunkXZ, Ops);
+}
+
+void AVoxelWorldManager::DropPredictionsForChunk_Client(const FChunkKey& Key, FVoxelChunkData& Data)
+{
+    TMap<int32, FPredictedCell> Cells;
+    if (PredictedCells.RemoveAndCopyValue(Key, Cells))
+    {
+        for (const TPair<int32, FPredictedCell>& Pair : Cells)
+        {
+            int32 LX = 0, LY = 0, LZ = 0;
+            XYZFromIndex(Pair.Key, LX, LY, LZ);
+            Data.SetBlockAt(LX, LY, LZ, (EBlockId)Pair.Value.ConfirmedId, /*bMarkModified*/true);
+        }
+    }
+
+    for (auto It = PendingPredictions.CreateIterator(); It; ++It)
+    {
+        if (It->Value.Key == Key) It.RemoveCurrent();
+    }
+}
+
+bool AVoxelWorldManager::GetChunkContent_Server(const FChunkKey& Key, uint32& OutHash, TSharedPtr<const TArray<uint8>>& OutPayload)
+{
+    if (const FServedChunkContent* Served = ServedContents.FindAndTouch(Key))
+    {
+        OutHash = Served->Hash;
+        OutPayload = Served->Payload;
+        return true;
+    }
+    if (ContentEncodesInFlight.Contains(Key)) return false;
+
+    // Shares the background slots with chunk and LOD builds, so a burst of requests can't flood the pool
+    if (GetFreeBackgroundSlots() <= 0) return false;
+    ContentEncodesInFlight.Add(Key);
+
+    // Loaded data holds the same generated blocks (edits live in ModifiedBlocks): copy them instead of generating
+    TSharedPtr<TArray<uint8>> LoadedBlocks;
+    if (const FChunkRecord* Rec = Loaded.Find(Key))
+    {
+        if (Rec->Data.IsValid()) LoadedBlocks = MakeShared<TArray<uint8>>(Rec->Data->Blocks);
+    }
+
+    const int32 Seed = WorldSeed;
+    Async(EAsyncExecution::ThreadPool, [this, Key, Seed, LoadedBlocks]()
+        {
+            FVoxelChunkData Data(Key);
+            if (LoadedBlocks.IsValid())
+            {
+                Data.Blocks = MoveTemp(*LoadedBlocks);
+            }
+            else
+            {
+                FVoxelGenerator Gen(Seed);
+                Gen.GenerateBaseChunk(Key, Data);
+            }
+
+            TSharedPtr<TArray<uint8>> Payload = MakeShared<TArray<uint8>>();
+            {
+                VOXEL_SCOPE(ContentEncode);
+                VoxelDeltaCodec::EncodeBlocks(Data.Blocks, *Payload);
+            }
+
+            FServedChunkContent Served;
+            Served.Hash = Data.ComputeBlocksHash();
+            Served.Payload = Payload;
+            CompletedContentEncodes.Enqueue(TPair<FChunkKey, FServedChunkContent>(Key, MoveTemp(Served)));
+        });
+    return false;
+}
+
+TSharedPtr<const TArray<uint8>> AVoxelWorldManager::FindStreamedContent_Client(const FChunkKey& Key)
+{
+    if (ConfirmedContents.Contains(Key))
+    {
+        if (const TSharedPtr<const TArray<uint8>>* Found = ContentCache.FindAndTouch(ChunkContentHashes.FindRef(Key)))
+        {
+            return *Found;
+        }
+        // Evicted since: ask for it again
+        ConfirmedContents.Remove(Key);
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    const double* AskedAt = RequestedContents.Find(Key);
+    if (!AskedAt || Now - *AskedAt > ContentRequestTimeoutSeconds)
+    {
+        RequestedContents.Add(Key, Now);
+
+        // A cached copy from earlier is only a candidate until the server confirms its hash
+        FVoxelChunkContentRequest& Req = OutgoingContentRequests.AddDefaulted_GetRef();
+        Req.ChunkXZ = FIntPoint(Key.X, Key.Z);
+        const uint32* Hash = ChunkContentHashes.Find(Key);
+        Req.Hash = (Hash && ContentCache.Contains(*Hash)) ? *Hash : 0;
+    }
+    return nullptr;
+}
+
+void AVoxelWorldManager::FlushContentRequests_Client()
+{
+    if (OutgoingContentRequests.Num() == 0) return;
+
+    AVoxelPlayerController* VPC = Cast<AVoxelPlayerController>(UGameplayStatics::GetPlayerController(GetWorld(), 0));
+    if (!VPC)
+    {
+        // Nobody to ask yet: try again next update
+        for (const FVoxelChunkContentRequest& Req : OutgoingContentRequests)
+        {
+            RequestedContents.Remove(FChunkKey(Req.ChunkXZ.X, Req.ChunkXZ.Y));
+        }
+        OutgoingContentRequests.Reset();
+        return;
+    }
+
+    // Already nearest first (the streaming loop walks the desired set by distance)
+    const int32 PerRPC = AVoxelPlayerController::MaxContentRequestsPerRPC;
+    for (int32 Start = 0; Start < OutgoingContentRequests.Num(); Start += PerRPC)
+    {
+        const int32 Num = FMath::Min(PerRPC, OutgoingContentRequests.Num() - Start);
+        VPC->Server_RequestChunkContents(TArray<FVoxelChunkContentRequest>(OutgoingContentRequests.GetData() + Start, Num));
+    }
+    OutgoingContentRequests.Reset();
+}
+
+void AVoxelWorldManager::ReceiveChunkContent(const FVoxelChunkContent& Content)
+{
+    const FChunkKey Key(Content.ChunkXZ.X, Content.ChunkXZ.Y);
+    RequestedContents.Remove(Key);
+
+    if (Content.Payload.Num() == 0)
+    {
+        // Our cached copy is current (if it was evicted meanwhile, the next streaming update asks again)
+        if (ContentCache.FindAndTouch(Content.Hash))
+        {
+            ChunkContentHashes.Add(Key, Content.Hash);
+            ConfirmedContents.Add(Key);
+        }
+        return;
+    }
+
+    // Full: the least recently used contents are evicted
+    if (!ContentCache.FindAndTouch(Content.Hash))
+    {
+        ContentCache.Add(Content.Hash, MakeShared<const TArray<uint8>>(Content.Payload));
+    }
+    ChunkContentHashes.Add(Key, Content.Hash);
+    ConfirmedContents.Add(Key);
+}
+
+int32 AVoxelWorldManager::GetClientDeltaSeq(const FIntPoint& ChunkXZ) const
+{
+    return ClientDeltaSeq.FindRef(FChunkKey(ChunkXZ.X, ChunkXZ.Y));
+}
+
+void AVoxelWorldManager::GetLoadedChunkKeys(TArray<FChunkKey>& OutKeys) const
+{
+    OutKeys.Reset(Loaded.Num());
+    for (const TPair<FChunkKey, FChunkRecord>& Pair : Loaded)
+    {
+        if (Pair.Value.Data.IsValid()) OutKeys.Add(Pair.Key);
+    }
+}
+
+FVoxelChunkVersion AVoxelWorldManager::GetClientChunkVersion(const FIntPoint& ChunkXZ) const
+{
+    const FChunkKey Key(ChunkXZ.X, ChunkXZ.Y);
+
+    FVoxelChunkVersion Version;
+    Version.ChunkXZ = ChunkXZ;
+    Version.Seq = ClientDeltaSeq.FindRef(Key);
+    if (const FChunkRecord* Rec = Loaded.Find(Key))
+    {
+        if (Rec->Data.IsValid()) Version.Hash = Rec->Data->ComputeModifiedHash();
+    }
+    return Version;
+}
+
 // ---------- tick / streaming ----------
 
 void AVoxelWorldManager::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
 
+    if (HasAuthority() && !bClientVisualInstance)
+    {
+        DrainEditQueue_Server();
+
+        // Contents encoded off-thread for clients that stream them
+        TPair<FChunkKey, FServedChunkContent> Encoded;
+        while (CompletedContentEncodes.Dequeue(Encoded))
+        {
+            ContentEncodesInFlight.Remove(Encoded.Key);
+            // Full: the least recently served chunk is evicted
+            ServedContents.Add(Encoded.Key, MoveTemp(Encoded.Value));
+        }
+    }
+
     // ---------------------------
     // Drain: time/vertex-budgeted
     // ---------------------------
     {
+        VOXEL_SCOPE(Drain);
         const double StartSec = FPlatformTime::Seconds();
         const double BudgetSec = DrainTimeBudgetMs / 1000.0;
 
         int32   DrainedItems = 0;
-        int32   DrainedVertices = 0;
+        int32   DrainedVertices = 0;        // render + collision, for the vertex budget
+        int32   DrainedChunks = 0;          // results that built render geometry
+        int32   DrainedRenderVertices = 0;  // of those, render sections only
+        int32   DrainedMeshBytes = 0;
         TSharedPtr<FChunkMeshResult> Res;
 
         // Pull completed results while within time, vertex, and item budgets.
         while (DrainedItems < DrainMaxItemsPerTick && Completed.Dequeue(Res))
         {
+            // Far LOD results have their own bookkeeping
+            if (Res->LOD > 0)
+            {
+                LODPending.Remove(Res->Key);
+                SpawnOrUpdateLODChunkFromResult(Res);
+                ++DrainedItems;
+                continue;
+            }
+
             // Remove from 'Pending' set to free a background slot
             Pending.Remove(Res->Key);
 
-            // Spawn/update visual actor for this chunk
-            SpawnOrUpdateChunkFromResult(Res);
-            ++DrainedItems;
+            // Count before the spawn moves the sections out of the result. The stats only cover results that built
+            // render geometry (every result carries CHUNK_NUM_SECTIONS slots, filled or not); collision sections
+            // still count against the vertex budget.
+            int32 RenderVertices = 0;
+            int32 RenderBytes = 0;
+            int32 CollisionVertices = 0;
+            for (const FProcMeshSection& Section : Res->Sections)
+            {
+                RenderVertices += Section.ProcVertexBuffer.Num();
+                RenderBytes += Section.ProcVertexBuffer.Num() * sizeof(FProcMeshVertex) + Section.ProcIndexBuffer.Num() * sizeof(uint32);
+            }
+            for (const TArray<FVoxelPackedVertex>& Section : Res->PackedSections)
+            {
+                RenderVertices += Section.Num();
+                RenderBytes += Section.Num() * sizeof(FVoxelPackedVertex);
+            }
+            for (const FProcMeshSection& Section : Res->CollisionSections)
+            {
+                CollisionVertices += Section.ProcVertexBuffer.Num();
+            }
+            if (RenderVertices > 0)
+            {
+                ++DrainedChunks;
+                DrainedRenderVertices += RenderVertices;
+                DrainedMeshBytes += RenderBytes;
+            }
 
-            // Track vertex budget (guard against pathological meshes)
-            DrainedVertices += Res->V.Num();
-            if (DrainedVertices >= DrainMaxVerticesPerTick)
+            // Spawn/update visual actor for this chunk (or just its collision)
+            if (Res->bCollisionOnly)
             {
-                break; // hit vertex budget
+                ApplyCollisionResult(Res);
+            }
+            else
+            {
+                SpawnOrUpdateChunkFromResult(Res);
             }
+            ++DrainedItems;
 
             // Rebuild if the record became dirty during async work
             if (FChunkRecord* Rec = Loaded.Find(Res->Key))
             {
                 if (Rec->bDirty && !Pending.Contains(Res->Key))
                 {
-                    Rec->bDirty = false;
-                    KickBuild(Res->Key, Rec->Data);
+                    // KickBuild picks up (and clears) Rec->DirtySections
+                    KickBuild(Res->Key, Rec->Data, Rec->DirtySections ? Rec->DirtySections : CHUNK_ALL_SECTIONS);
                 }
             }
 
+            // Track vertex budget (guard against pathological meshes)
+            DrainedVertices += RenderVertices + CollisionVertices;
+            if (DrainedVertices >= DrainMaxVerticesPerTick)
+            {
+                break; // hit vertex budget
+            }
+
             // Time budget check last (cheapest to evaluate at end of body)
             const double NowSec = FPlatformTime::Seconds();
             if ((NowSec - StartSec) >= BudgetSec)
@@ -710,6 +2215,30 @@ void AVoxelWorldManager::Tick(float DeltaSeconds)
                 break; // hit time budget
             }
         }
+
+        VOXEL_COUNT(ChunksDrained, DrainedChunks);
+        VOXEL_COUNT(VerticesDrained, DrainedRenderVertices);
+        VOXEL_COUNT(MeshBytesDrained, DrainedMeshBytes);
+        if (DrainedChunks > 0)
+        {
+            VOXEL_SET_AVERAGE(VerticesPerChunk, (float)DrainedRenderVertices / DrainedChunks);
+            VOXEL_SET_AVERAGE(MeshBytesPerChunk, (float)DrainedMeshBytes / DrainedChunks);
+        }
+    }
+
+    // Queue depths, every tick
+    VOXEL_COUNT(LoadedChunks, Loaded.Num());
+    VOXEL_COUNT(PendingBuilds, Pending.Num());
+    VOXEL_COUNT(PendingLODBuilds, LODPending.Num());
+    VOXEL_COUNT(EditQueueDepth, EditQueue.Num() - EditQueueHead);
+    VOXEL_COUNT(QueuedOpChunks, PendingNetDeltas.Num());
+    VOXEL_COUNT(ContentRequests, RequestedContents.Num());
+    VOXEL_COUNT(ContentEncodes, ContentEncodesInFlight.Num());
+
+    // Horizon tiles upload on their own small budget
+    if (IsValid(FarTerrain))
+    {
+        FarTerrain->DrainResults(FarTerrainUploadsPerTick);
     }
 
     // -----------------------------
@@ -718,12 +2247,15 @@ void AVoxelWorldManager::Tick(float DeltaSeconds)
     TimeAcc += DeltaSeconds;
     if (TimeAcc < UpdateIntervalSeconds) return;
     TimeAcc = 0.f;
+    VOXEL_SCOPE(StreamingUpdate);
 
     // === build desired set around ALL tracked actors ===
     TArray<FIntPoint> Centers;
     GatherCenters(Centers);
     if (Centers.Num() == 0) return;
 
+    UpdateCollisionCenters(Centers);
+
     // Union of desired chunks
     TSet<FChunkKey> Desired;
     for (const FIntPoint& C : Centers)
@@ -756,8 +2288,7 @@ void AVoxelWorldManager::Tick(float DeltaSeconds)
     // ------------------------------------------
     // Enqueue: cap both concurrency and per-tick
     // ------------------------------------------
-    int32 Slots = FMath::Max(0, MaxConcurrentBackgroundTasks - Pending.Num());
-    int32 EnqueueBudget = FMath::Min(Slots, MaxEnqueuesPerTick);
+    int32 EnqueueBudget = FMath::Min(GetFreeBackgroundSlots(), MaxEnqueuesPerTick);
 
     for (const FChunkKey& K : DesiredOrdered)
     {
@@ -769,9 +2300,32 @@ void AVoxelWorldManager::Tick(float DeltaSeconds)
         if (Pending.Contains(K)) continue; // already building
 
         TSharedPtr<FVoxelChunkData> Existing = Rec ? Rec->Data : nullptr;
+
+        // Streaming contents: nothing to build until the server's blocks are here (costs no budget meanwhile)
+        if (!Existing.IsValid() && bClientVisualInstance && bStreamChunkContents && !FindStreamedContent_Client(K).IsValid())
+        {
+            continue;
+        }
+
         KickBuild(K, Existing);
         --EnqueueBudget;
     }
+
+    if (bClientVisualInstance)
+    {
+        FlushContentRequests_Client();
+    }
+
+    // Collision around pawns comes before the far rings
+    UpdateCollisionRadius(EnqueueBudget);
+
+    // Far rings get whatever budget the full-resolution chunks left over
+    if (IsLODActive())
+    {
+        UpdateLODRings(Centers, EnqueueBudget);
+    }
+
+    UpdateFarTerrain(Centers);
 }
 
 
@@ -807,53 +2361,3 @@ void AVoxelWorldManager::ClearTrackedActors()
 {
     TrackedActors.Reset();
 }
-
-// ---------- replicated chunk net-state helpers (server only) ----------
-
-AVoxelChunkNetState* AVoxelWorldManager::GetOrCreateNetState_Server(const FChunkKey& Key)
-{
-    if (!HasAuthority()) return nullptr;
-
-    if (TWeakObjectPtr<AVoxelChunkNetState>* Found = ChunkNetStates.Find(Key))
-    {
-        if (Found->IsValid()) return Found->Get();
-    }
-
-    FActorSpawnParameters SP;
-    SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-    AVoxelChunkNetState* NS = GetWorld()->SpawnActor<AVoxelChunkNetState>(FVector::ZeroVector, FRotator::ZeroRotator, SP);
-    if (!NS) return nullptr;
-
-    NS->ChunkXZ = FIntPoint(Key.X, Key.Z);
-    NS->Cells.Owner = NS;
-    NS->OnNetStateDestroyed.AddUObject(this, &AVoxelWorldManager::HandleNetStateDestroyed);
-    ChunkNetStates.Add(Key, NS);
-    return NS;
-}
-
-void AVoxelWorldManager::DestroyNetState_Server(const FChunkKey& Key)
-{
-    if (!HasAuthority()) return;
-
-    if (TWeakObjectPtr<AVoxelChunkNetState>* Found = ChunkNetStates.Find(Key))
-    {
-        if (Found->IsValid())
-        {
-            Found->Get()->Destroy();
-        }
-        ChunkNetStates.Remove(Key);
-    }
-}
-
-void AVoxelWorldManager::HandleNetStateDestroyed(AVoxelChunkNetState* State)
-{
-    if (!State) return;
-    for (auto It = ChunkNetStates.CreateIterator(); It; ++It)
-    {
-        if (It->Value.Get() == State)
-        {
-            It.RemoveCurrent();
-            break;
-        }
-    }
-}
@@ -0,0 +1,47 @@
+#include "VoxelWorldSubsystem.h"
+#include "VoxelWorldManager.h"
+#include "Engine/World.h"
+
+void UVoxelWorldSubsystem::RegisterManager(AVoxelWorldManager* Manager)
+{
+    if (Manager)
+    {
+        Managers.AddUnique(Manager);
+    }
+}
+
+void UVoxelWorldSubsystem::UnregisterManager(AVoxelWorldManager* Manager)
+{
+    Managers.RemoveAll([Manager](const TWeakObjectPtr<AVoxelWorldManager>& M) { return !M.IsValid() || M.Get() == Manager; });
+}
+
+AVoxelWorldManager* UVoxelWorldSubsystem::GetAuthoritativeManager() const
+{
+    for (const TWeakObjectPtr<AVoxelWorldManager>& Weak : Managers)
+    {
+        AVoxelWorldManager* M = Weak.Get();
+        if (M && M->HasAuthority() && !M->bClientVisualInstance) return M;
+    }
+    return nullptr;
+}
+
+AVoxelWorldManager* UVoxelWorldSubsystem::GetClientVisualManager() const
+{
+    for (const TWeakObjectPtr<AVoxelWorldManager>& Weak : Managers)
+    {
+        AVoxelWorldManager* M = Weak.Get();
+        if (M && M->bClientVisualInstance) return M;
+    }
+    return nullptr;
+}
+
+AVoxelWorldManager* UVoxelWorldSubsystem::GetLocalManager() const
+{
+    if (AVoxelWorldManager* Visual = GetClientVisualManager()) return Visual;
+
+    for (const TWeakObjectPtr<AVoxelWorldManager>& Weak : Managers)
+    {
+        if (AVoxelWorldManager* M = Weak.Get()) return M;
+    }
+    return nullptr;
+}
@@ -267,14 +267,9 @@ bool UWorldPersistenceLibrary::GetSurfaceSpawnAtOrigin(int32 Seed, float BlockSi
 	const int32 X = CHUNK_SIZE_X / 2;
 	const int32 Z = CHUNK_SIZE_Z / 2;
 
-	int32 SurfaceY = CHUNK_SIZE_Y - 1;
-	for (int32 y = CHUNK_SIZE_Y - 1; y >= 0; --y)
-	{
-		if (Data.GetBlockAt(X, y, Z) != EBlockId::Air)
-		{
-			SurfaceY = y; break;
-		}
-	}
+	// Highest non-air cell comes from the column extents (no top-down scan)
+	const int32 TopY = Data.GetColumnTopY(X, Z);
+	const int32 SurfaceY = TopY >= 0 ? TopY : CHUNK_SIZE_Y - 1;
 
 	const FVector WorldLocation(
 		(double)Key.X * CHUNK_SIZE_X * BlockSize + X * BlockSize + 0.5 * BlockSize,
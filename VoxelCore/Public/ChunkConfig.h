@@ -1,9 +1,19 @@
 #pragma once
 
-// Chunk size config - change these constants project-wide if needed.
-constexpr int32 CHUNK_SIZE_X = 16;
-constexpr int32 CHUNK_SIZE_Y = 128; // vertical axis
-constexpr int32 CHUNK_SIZE_Z = 16;
-constexpr int32 CHUNK_VOLUME = CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SIZE_Z;
+#include "CoreMinimal.h"
+#include "VoxelKernel/ChunkLayout.h"
+
+// Chunk size config lives with the kernels (VoxelKernel/ChunkLayout.h); these are the names engine code uses.
+using VoxelKernel::CHUNK_SIZE_X;
+using VoxelKernel::CHUNK_SIZE_Y; // vertical axis
+using VoxelKernel::CHUNK_SIZE_Z;
+using VoxelKernel::CHUNK_VOLUME;
+using VoxelKernel::CHUNK_COLUMNS;
+
+// Vertical mesh sections: a chunk is meshed and uploaded as CHUNK_NUM_SECTIONS slabs of this many layers.
+using VoxelKernel::CHUNK_SECTION_SIZE_Y;
+using VoxelKernel::CHUNK_NUM_SECTIONS;
+using VoxelKernel::CHUNK_ALL_SECTIONS;
+static_assert(VoxelKernel::WHOLE_CHUNK == INDEX_NONE, "Kernels take INDEX_NONE as the whole-chunk section");
 
 constexpr int32 DEFAULT_WORLD_SEED = 1337;
\ No newline at end of file
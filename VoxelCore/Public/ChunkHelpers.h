@@ -5,21 +5,8 @@
 // Indexing convention:
 // X in [0,CHUNK_SIZE_X), Y in [0,CHUNK_SIZE_Y) vertical, Z in [0,CHUNK_SIZE_Z)
 // Index = X + Z * CHUNK_SIZE_X + Y * (CHUNK_SIZE_X * CHUNK_SIZE_Z)
-
-inline int32 IndexFromXYZ(int32 X, int32 Y, int32 Z)
-{
-	return X + Z * CHUNK_SIZE_X + Y * (CHUNK_SIZE_X * CHUNK_SIZE_Z);
-}
-
-
-inline void XYZFromIndex(int32 Index, int32& OutX, int32& OutY, int32& OutZ)
-{
-	const int32 XYPlane = CHUNK_SIZE_X * CHUNK_SIZE_Z; // blocks per vertical layer
-	OutY = Index / XYPlane;
-	int32 Rem = Index - (OutY * XYPlane);
-	OutZ = Rem / CHUNK_SIZE_X;
-	OutX = Rem - (OutZ * CHUNK_SIZE_X);
-}
+using VoxelKernel::IndexFromXYZ;
+using VoxelKernel::XYZFromIndex;
 
 // Simple chunk key (2D chunks: chunk X and chunk Z)
 struct FChunkKey
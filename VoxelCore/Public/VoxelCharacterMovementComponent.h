@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "VoxelCharacterMovementComponent.generated.h"
+
+class AVoxelWorldManager;
+
+// CustomMovementMode values used while moving against the voxel grid (ground / air, like MOVE_Walking / MOVE_Falling).
+enum EVoxelCustomMovementMode : uint8
+{
+    VOXEL_MOVE_Walking = 0,
+    VOXEL_MOVE_Falling = 1,
+};
+
+/**
+ * Character movement that collides with voxel data instead of cooked chunk collision.
+ * - Walking/falling run as MOVE_Custom (VOXEL_MOVE_Walking / VOXEL_MOVE_Falling): the capsule is treated as
+ *   a box (Radius, Radius, HalfHeight) and moved with AVoxelWorldManager::VoxelSlideBox, stepping up ledges
+ *   no higher than MaxStepHeight.
+ * - Requests for walking/falling (jumps, launches, default mode) are redirected to the voxel modes, so jumping,
+ *   air control, landing events and saved-move replay keep working through the regular CMC paths.
+ * - Only voxels are collided with; other actors are not swept against in this mode.
+ * Use with ObjectInitializer.SetDefaultSubobjectClass<UVoxelCharacterMovementComponent>(ACharacter::CharacterMovementComponentName).
+ */
+UCLASS()
+class VOXELCORE_API UVoxelCharacterMovementComponent : public UCharacterMovementComponent
+{
+    GENERATED_BODY()
+public:
+    // Off = stock walking/falling against physics collision.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Movement")
+    bool bUseVoxelCollision = true;
+
+    // Distance below the feet that still counts as standing on a block.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Movement", meta = (ClampMin = "0.1"))
+    float VoxelGroundProbe = 2.f;
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel|Movement")
+    bool IsInVoxelMode() const
+    {
+        return MovementMode == MOVE_Custom && (CustomMovementMode == VOXEL_MOVE_Walking || CustomMovementMode == VOXEL_MOVE_Falling);
+    }
+
+    virtual void SetMovementMode(EMovementMode NewMovementMode, uint8 NewCustomMode = 0) override;
+    virtual bool IsMovingOnGround() const override;
+    virtual bool IsFalling() const override;
+    virtual float GetMaxSpeed() const override;
+    virtual float GetMaxBrakingDeceleration() const override;
+
+protected:
+    virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+
+private:
+    TWeakObjectPtr<AVoxelWorldManager> VoxelWorld;
+
+    // Server: the authoritative manager. Clients: the client-visual manager holding the same blocks.
+    AVoxelWorldManager* GetVoxelWorld();
+    FVector GetVoxelExtent() const;
+    void PhysVoxel(float DeltaTime, AVoxelWorldManager& World);
+};
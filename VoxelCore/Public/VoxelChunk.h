@@ -4,6 +4,7 @@
 #include "ChunkConfig.h"     // CHUNK_SIZE_*
 #include "ChunkHelpers.h"    // FChunkKey, IndexFromXYZ(...)
 #include "VoxelTypes.h"      // EBlockId
+#include "VoxelKernel/ChunkStorage.h"
 
 // One chunks voxel data: base array + delta overrides (flat index -> id).
 struct FVoxelChunkData
@@ -17,6 +18,11 @@ struct FVoxelChunkData
     // Deltas (persisted): localIndex -> blockId (16-bit for future-proofing).
     TMap<int32, uint16> ModifiedBlocks;
 
+    // Vertical extents of non-air cells (effective ids, deltas included).
+    // Per column (X + Z*CHUNK_SIZE_X) and for the whole chunk; an empty range has Min > Max.
+    // Kept current by SetBlockAt; call RecomputeExtents after writing Blocks/ModifiedBlocks directly.
+    VoxelKernel::FChunkExtents Extents;
+
     // Ctors
     FVoxelChunkData() = default;
 
@@ -79,10 +85,109 @@ struct FVoxelChunkData
         {
             Blocks[Index] = Raw;
         }
+
+        UpdateExtentsAt(X, Y, Z);
     }
 
     FORCEINLINE void ClearDeltas()
     {
         ModifiedBlocks.Empty();
     }
+
+    // Content hash of the delta set (order independent, 0 when empty), for comparing copies across the network.
+    uint32 ComputeModifiedHash() const
+    {
+        uint32 Hash = 0;
+        for (const TPair<int32, uint16>& P : ModifiedBlocks)
+        {
+            Hash += MurmurFinalize32(((uint32)P.Key << 8) ^ (uint32)P.Value ^ 0x9E3779B9u);
+        }
+        return Hash;
+    }
+
+    // Content hash of the generated blocks (never 0), keying streamed chunk contents across the network.
+    uint32 ComputeBlocksHash() const
+    {
+        const uint32 Hash = FCrc::MemCrc32(Blocks.GetData(), Blocks.Num());
+        return Hash ? Hash : 1u;
+    }
+
+    // ---- Vertical extents ----
+    FORCEINLINE static int32 ColumnIndex(int32 X, int32 Z) { return VoxelKernel::ColumnIndex(X, Z); }
+
+    FORCEINLINE bool IsEmpty() const { return Extents.IsEmpty(); }
+    FORCEINLINE bool IsColumnEmpty(int32 X, int32 Z) const { return Extents.IsColumnEmpty(ColumnIndex(X, Z)); }
+
+    // Highest non-air Y in the column, or -1 if the column is all air.
+    FORCEINLINE int32 GetColumnTopY(int32 X, int32 Z) const
+    {
+        return Extents.GetColumnTopY(ColumnIndex(X, Z));
+    }
+
+    FORCEINLINE void ResetExtents()
+    {
+        Extents.Reset();
+    }
+
+    // Full rebuild from Blocks + ModifiedBlocks (after generation / delta load).
+    void RecomputeExtents()
+    {
+        if (Blocks.Num() != CHUNK_VOLUME)
+        {
+            ResetExtents();
+            return;
+        }
+        VoxelKernel::ComputeExtents(Blocks.GetData(), Extents);
+
+        // Deltas can both add and remove cells; re-scan only the columns they touch.
+        for (const TPair<int32, uint16>& P : ModifiedBlocks)
+        {
+            int32 X = 0, Y = 0, Z = 0;
+            XYZFromIndex(P.Key, X, Y, Z);
+            if (IsInBounds(X, Y, Z)) RescanColumn(X, Z);
+        }
+
+        Extents.FoldColumns();
+    }
+
+    // Dense view for the kernels: Blocks itself when there are no deltas, otherwise a copy in Scratch with the
+    // deltas applied. Valid while this chunk and Scratch are unchanged.
+    VoxelKernel::FChunkView MakeView(TArray<uint8>& Scratch) const
+    {
+        VoxelKernel::FChunkView View;
+        View.Blocks = Blocks.GetData();
+        View.Extents = &Extents;
+
+        if (ModifiedBlocks.Num() > 0 && Blocks.Num() == CHUNK_VOLUME)
+        {
+            Scratch = Blocks;
+            for (const TPair<int32, uint16>& P : ModifiedBlocks)
+            {
+                if (Scratch.IsValidIndex(P.Key)) Scratch[P.Key] = static_cast<uint8>(P.Value);
+            }
+            View.Blocks = Scratch.GetData();
+        }
+        return View;
+    }
+
+private:
+    FORCEINLINE void UpdateExtentsAt(int32 X, int32 Y, int32 Z)
+    {
+        const int32 C = ColumnIndex(X, Z);
+        if (GetBlockAt(X, Y, Z) != EBlockId::Air)
+        {
+            Extents.Grow(X, Y, Z);
+        }
+        else if (Y == Extents.ColumnMinY[C] || Y == Extents.ColumnMaxY[C])
+        {
+            // Removed a column boundary: re-scan that column, then fold the columns again
+            RescanColumn(X, Z);
+            Extents.FoldColumns();
+        }
+    }
+
+    void RescanColumn(int32 X, int32 Z)
+    {
+        Extents.RescanColumn(X, Z, [this, X, Z](int32 Y) { return GetBlockAt(X, Y, Z) != EBlockId::Air; });
+    }
 };
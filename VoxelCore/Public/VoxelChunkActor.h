@@ -3,6 +3,7 @@
 #include "GameFramework/Actor.h"
 #include "ProceduralMeshComponent.h"
 #include "VoxelChunk.h" // <-- for FVoxelChunkData
+#include "VoxelMesher.h" // FVoxelPackedVertex
 #include "VoxelChunkActor.generated.h"
 
 UCLASS()
@@ -15,6 +16,10 @@ public:
     UPROPERTY(VisibleAnywhere)
     UProceduralMeshComponent* ProcMesh;
 
+    // Packed render path (see BuildFromPacked). Empty unless the manager uses packed rendering.
+    UPROPERTY(VisibleAnywhere)
+    class UVoxelChunkComponent* ChunkMesh;
+
     UPROPERTY(EditAnywhere, Category = "Voxel")
     float BlockSize = 100.f;
 
@@ -37,6 +42,45 @@ public:
         const TArray<FProcMeshTangent>& Tangents,
         UMaterialInterface* UseMaterial);
 
+    // Procedural slots: one render section per CHUNK_SECTION_SIZE_Y slab, then one hidden collision section per slab
+    // (FVoxelMesher_Naive::BuildCollisionSection). Only the collision slots are cooked.
+    static constexpr int32 FirstCollisionSection = CHUNK_NUM_SECTIONS;
+
+    // Trusted fast path for mesher output: takes ownership of the vertical sections in SectionMask
+    // (indexed like Sections) and of the collision sections in CollisionMask. Others keep their mesh.
+    // CollisionSections = nullptr with a non-zero mask empties those collision slots.
+    // No validation and no per-vertex conversion; buffers are moved into the component, with one refresh per call.
+    // That refresh re-uploads all render sections (procedural proxy); see BuildFromPacked for per-section uploads.
+    void BuildFromSections(TArray<FProcMeshSection>& Sections, uint32 SectionMask, UMaterialInterface* UseMaterial,
+        TArray<FProcMeshSection>* CollisionSections = nullptr, uint32 CollisionMask = 0);
+
+    // Packed render path: draws through ChunkMesh at 8 bytes per vertex. Collision still goes through the procedural
+    // component, so chunks inside the collision radius also keep their (greedy, much smaller) FProcMeshSection
+    // collision sections on the game thread; chunks outside it hold no procedural data at all.
+    void BuildFromPacked(TArray<TArray<FVoxelPackedVertex>>& Packed, const TArray<FBox>& VoxelBounds, uint32 SectionMask,
+        TArray<FProcMeshSection>* CollisionSections, uint32 CollisionMask, UMaterialInterface* UseMaterial);
+
+    // Collision only, for chunks entering the collision radius (one cook).
+    void SetCollisionSections(TArray<FProcMeshSection>& CollisionSections, uint32 CollisionMask);
+
+    // Drop every collision section (chunk left the collision radius).
+    void ClearCollision();
+
+    // Far LOD chunks: section 0 only (from the mesher's BuildLOD* calls), render only, no collision on the actor.
+    void BuildFromLOD(TArray<FProcMeshSection>& Sections, TArray<TArray<FVoxelPackedVertex>>& Packed,
+        const TArray<FBox>& PackedVoxelBounds, bool bPacked, UMaterialInterface* UseMaterial);
+
     // NEW: used by VoxelChunkSpawnCommand.cpp
     void BuildFromChunk(const FVoxelChunkData& Chunk, float InBlockSize, UMaterialInterface* UseMaterial);
+
+private:
+    // Collision/lighting/material settings shared by both build paths.
+    void ApplySectionSettings(UMaterialInterface* UseMaterial);
+
+    // Move Sections[s] into slot FirstSlot + s for every s in Mask (nullptr = empty those slots).
+    // Returns the last slot touched, or INDEX_NONE.
+    int32 MoveIntoSlots(TArray<FProcMeshSection>* Sections, uint32 Mask, int32 FirstSlot);
+
+    // Single bounds/collision/render refresh for everything moved in since the last one.
+    void RefreshSlots(int32 LastSlot);
 };
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/MeshComponent.h"
+#include "VoxelMesher.h" // FVoxelPackedVertex
+#include "VoxelChunkComponent.generated.h"
+
+/**
+ * Render-only chunk component fed with packed 8-byte vertices.
+ * - Keeps only the packed buffer on the game thread for rendering (no FProcMeshSection copy of the render mesh).
+ * - The scene proxy expands vertices on the render thread into compact local vertex factory streams, with separate
+ *   buffers per vertical section: SetPackedSections on a live proxy re-uploads only the sections it was given.
+ * - No collision; the owning actor keeps collision on its procedural mesh.
+ * Works under -nullrhi (resources are created against the null RHI, bounds/counts stay queryable).
+ */
+UCLASS(ClassGroup = (Voxel), meta = (BlueprintSpawnableComponent))
+class VOXELCORE_API UVoxelChunkComponent : public UMeshComponent
+{
+    GENERATED_BODY()
+public:
+    UVoxelChunkComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+    UPROPERTY(EditAnywhere, Category = "Voxel")
+    float BlockSize = 100.f;
+
+    // Take ownership of the vertical sections in SectionMask (moved out of InSections) and refresh bounds. A live proxy
+    // rebuilds just those sections' GPU buffers; other sections keep theirs. VoxelBounds are the per-section packed
+    // corner bounds in voxel units (world axis order), as BuildPackedMesh reports them.
+    void SetPackedSections(TArray<TArray<FVoxelPackedVertex>>& InSections, const TArray<FBox>& InVoxelBounds, uint32 SectionMask);
+    void ClearPackedVertices();
+
+    const TArray<FVoxelPackedVertex>& GetPackedSection(int32 SectionIndex) const { return PackedSections[SectionIndex]; }
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel|Chunk")
+    int32 GetNumPackedVertices() const;
+
+    //~ UPrimitiveComponent
+    virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+    virtual int32 GetNumMaterials() const override { return 1; }
+
+    //~ USceneComponent
+    virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+
+private:
+    void UpdateLocalBox();
+
+    TArray<FVoxelPackedVertex> PackedSections[CHUNK_NUM_SECTIONS];
+    FBox SectionVoxelBounds[CHUNK_NUM_SECTIONS];
+    FBox LocalBox = FBox(ForceInit);
+};
@@ -0,0 +1,28 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "VoxelTypes.h"
+#include "ChunkConfig.h"
+
+// Compact wire format for chunk cell lists (snapshots and deltas).
+// Cells are sorted by index and grouped into runs of consecutive indices with the same id; each run is
+// the gap from the previous run (varint, so neighboring edits cost a byte or two instead of 15 bits),
+// its length (varint) and a palette slot (just enough bits for the palette). Bodies above
+// CompressThresholdBytes are zlib-compressed when that is smaller.
+namespace VoxelDeltaCodec
+{
+	// Largest payload Decode accepts (every cell its own run, plus headers).
+	constexpr int32 MaxPayloadBytes = CHUNK_VOLUME * 8 + 1024;
+
+	// The last op per cell wins.
+	VOXELCORE_API void Encode(const TArray<FVoxelCellOp>& Ops, TArray<uint8>& OutPayload, int32 CompressThresholdBytes = 256);
+
+	// False on a malformed payload (bad sizes, indices outside the chunk); OutOps is then empty.
+	VOXELCORE_API bool Decode(const TArray<uint8>& Payload, TArray<FVoxelCellOp>& OutOps);
+
+	// A whole chunk's cells (CHUNK_VOLUME ids, e.g. FVoxelChunkData::Blocks) in the same format: one run per
+	// stretch of equal ids, so layered terrain costs a few hundred runs before compression.
+	VOXELCORE_API void EncodeBlocks(const TArray<uint8>& Blocks, TArray<uint8>& OutPayload, int32 CompressThresholdBytes = 256);
+
+	// False unless the payload's runs cover every cell of the chunk.
+	VOXELCORE_API bool DecodeBlocks(const TArray<uint8>& Payload, TArray<uint8>& OutBlocks);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ProceduralMeshComponent.h"
+#include "Containers/Queue.h"
+#include "VoxelFarTerrainActor.generated.h"
+
+// Off-thread result for one far terrain tile.
+struct FFarTerrainTileResult
+{
+    FIntPoint Tile = FIntPoint::ZeroValue;
+    int32 Stride = 0;
+    FProcMeshSection Section;
+};
+
+/**
+ * Horizon renderer past the voxel chunks: a clipmap-style ring of heightmap tiles.
+ * - Tiles are HorizonTileChunks x HorizonTileChunks chunks, sampled every Stride columns straight from
+ *   FVoxelGenerator (no voxel data). Stride doubles with each clipmap level away from the center.
+ * - Only tiles that appear, or change level, are rebuilt (off-thread) when the center moves.
+ * - The mesh is sunk slightly so any real chunk geometry in the same area draws over it.
+ * - Every tile is its own (pooled) procedural mesh component, so uploading a tile recreates only that tile's proxy.
+ * Render only: no collision.
+ */
+UCLASS()
+class VOXELCORE_API AVoxelFarTerrainActor : public AActor
+{
+    GENERATED_BODY()
+public:
+    AVoxelFarTerrainActor();
+
+    UPROPERTY(VisibleAnywhere)
+    USceneComponent* Root;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon")
+    float BlockSize = 100.f;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon")
+    int32 WorldSeed = 1337;
+
+    // Tile edge in chunks.
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon", meta = (ClampMin = "1"))
+    int32 HorizonTileChunks = 8;
+
+    // Sample spacing (columns) of the innermost level; doubles per level.
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon", meta = (ClampMin = "1"))
+    int32 BaseStrideColumns = 4;
+
+    // Tiles (Chebyshev, from the center tile) covered by the innermost level; each next level doubles it.
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon", meta = (ClampMin = "1"))
+    int32 FirstLevelTiles = 3;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon", meta = (ClampMin = "0"))
+    int32 MaxLevel = 3;
+
+    // Sink below the true surface (blocks), so nearby voxel chunks win the depth test.
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon", meta = (ClampMin = "0.0"))
+    float SinkBlocks = 2.f;
+
+    // Chebyshev world bound in chunks (0 = unbounded); tiles fully outside it are never built.
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon", meta = (ClampMin = "0"))
+    int32 WorldLimitChunks = 0;
+
+    // Tile builds started per UpdateCenter call.
+    UPROPERTY(EditAnywhere, Category = "Voxel|Horizon", meta = (ClampMin = "1"))
+    int32 MaxTileBuildsPerUpdate = 4;
+
+    void SetMaterial(UMaterialInterface* InMaterial);
+
+    // Re-plan the ring around CenterChunk. Tiles whose chunk range lies completely within InnerRadiusChunks
+    // (covered by voxel chunks) and tiles past OuterRadiusChunks are dropped.
+    void UpdateCenter(const FIntPoint& CenterChunk, int32 InnerRadiusChunks, int32 OuterRadiusChunks);
+
+    // Upload finished tiles (game thread); at most MaxItems per call.
+    void DrainResults(int32 MaxItems);
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel|Horizon")
+    int32 GetNumTiles() const { return Tiles.Num(); }
+
+private:
+    struct FTileState
+    {
+        int32 Slot = INDEX_NONE; // index into TileMeshes
+        int32 Stride = 0;        // stride currently uploaded (0 = nothing yet)
+        int32 WantedStride = 0;
+        bool bPending = false;
+    };
+
+    TMap<FIntPoint, FTileState> Tiles;
+
+    // Tile components (mesh in section 0); released tiles go back to FreeSlots for reuse.
+    UPROPERTY(Transient)
+    TArray<UProceduralMeshComponent*> TileMeshes;
+    TArray<int32> FreeSlots;
+
+    // Shared with worker tasks (they never touch the actor), so a task finishing after EndPlay is harmless.
+    using FResultQueue = TQueue<TSharedPtr<FFarTerrainTileResult>, EQueueMode::Mpsc>;
+    TSharedPtr<FResultQueue, ESPMode::ThreadSafe> Completed;
+
+    UPROPERTY(Transient)
+    UMaterialInterface* Material = nullptr;
+
+    int32 GetStrideForTileDistance(int32 TileDistance) const;
+    void KickTileBuild(const FIntPoint& Tile, int32 Stride);
+    int32 AcquireTileMesh();
+    void ReleaseTile(FTileState& State);
+};
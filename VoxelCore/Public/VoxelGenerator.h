@@ -4,10 +4,10 @@
 #include "ChunkHelpers.h"
 #include "ChunkConfig.h"
 #include "VoxelChunk.h"
-#include "FastNoiseLite.h"
+#include "VoxelKernel/TerrainGenerator.h"
 
 /**
- * Deterministic chunk generator using FastNoiseLite.
+ * Deterministic chunk generator: engine wrapper around VoxelKernel::FTerrainGenerator (FastNoiseLite).
  * - Produces a base terrain: stone deep, dirt a few layers, grass on top, air above.
  * - Deterministic based on seed + chunk coords.
  */
@@ -20,27 +20,19 @@ public:
     void GenerateBaseChunk(const FChunkKey& Key, FVoxelChunkData& OutChunk);
 
     /** Generator parameters (tweakable) */
-    void SetHeightScale(float InScale) { HeightScale = InScale; }
-    void SetHeightOffset(float InOffset) { HeightOffset = InOffset; }
-    void SetNoiseFrequency(float InFreq) { NoiseFrequency = InFreq; }
+    void SetHeightScale(float InScale) { Terrain.SetHeightScale(InScale); }
+    void SetHeightOffset(float InOffset) { Terrain.SetHeightOffset(InOffset); }
+    void SetNoiseFrequency(float InFreq) { Terrain.SetNoiseFrequency(InFreq); }
 
-    int32 SampleColumnTopY(int32 WorldX, int32 WorldZ) const;
+    int32 SampleColumnTopY(int32 WorldX, int32 WorldZ) const { return Terrain.SampleColumnTopY(WorldX, WorldZ); }
+
+    /** Batched heightmap: NumX * NumZ column tops starting at (WorldX0, WorldZ0), every Stride columns.
+     * OutTops is row-major (X fastest). Safe to call from worker threads. */
+    void SampleColumnTopYGrid(int32 WorldX0, int32 WorldZ0, int32 Stride, int32 NumX, int32 NumZ, TArray<int32>& OutTops) const;
+
+    /** Block GenerateBaseChunk puts at the top of every column (the layering only depends on depth). */
+    static EBlockId GetSurfaceBlock() { return static_cast<EBlockId>(VoxelKernel::FTerrainGenerator::GetBlockAtDepth(0)); }
 
 private:
-    int32 Seed;
-    FastNoiseLite NoiseHeight;
-    float HeightScale;    // multiplier to convert noise to height
-    float HeightOffset;   // additive offset
-    float NoiseFrequency; // frequency scale for noise inputs
-
-    FORCEINLINE int32 WorldHeightFromNoise(float NoiseValue) const
-    {
-        // noise expected in [-1,1]. Map to [0, CHUNK_SIZE_Y-1]
-        float Norm = (NoiseValue + 1.0f) * 0.5f; // 0..1
-        float TotalMaxHeight = static_cast<float>(CHUNK_SIZE_Y - 1);
-        float H = Norm * HeightScale + HeightOffset;
-        // Clamp to chunk height bounds
-        int32 HeightInt = FMath::Clamp(static_cast<int32>(FMath::RoundToInt(H)), 1, CHUNK_SIZE_Y - 1);
-        return HeightInt;
-    }
+    VoxelKernel::FTerrainGenerator Terrain;
 };
@@ -4,6 +4,67 @@
 #include "VoxelChunk.h"
 #include "VoxelTypes.h"
 #include "ProceduralMeshComponent.h"
+#include "VoxelKernel/ChunkMesher.h"
+
+// Face culling, collision merging, LOD sampling and the packed vertex format are VoxelKernel code (ChunkMesher.h);
+// this file turns their output into engine mesh data.
+
+// Cube face in world axes (voxel Z is world Y, voxel Y is world Z). Order is the mesher's emit order.
+using EVoxelFace = VoxelKernel::EFace;
+
+// Compact 8-byte chunk vertex (layout in VoxelKernel::FPackedVertex).
+using FVoxelPackedVertex = VoxelKernel::FPackedVertex;
+
+// Far-chunk LODs: level L downsamples columns by (1 << L), i.e. 2x / 4x / 8x.
+constexpr int32 VOXEL_MAX_LOD = VoxelKernel::MAX_LOD;
+
+/**
+ * Read-only copy of the neighbor layers touching a chunk's four vertical sides.
+ * Captured on the game thread when a build is kicked, so the worker never reads another chunk's live data.
+ */
+struct FVoxelChunkBorders
+{
+    // Sides in chunk-key space (chunk Z is world Y).
+    enum ESide : int32 { PosX = 0, NegX = 1, PosZ = 2, NegZ = 3, NumSides = 4 };
+
+    // Per side: ids of the touching neighbor layer, Along + Y * AlongSize (along = Z for X sides, X for Z sides).
+    // Empty when the neighbor was not available.
+    TArray<uint8> Slabs[NumSides];
+
+    // Assumption for sides without a slab: false = air (emit border faces), true = solid (cull them).
+    bool bMissingIsSolid = false;
+
+    static FORCEINLINE int32 AlongSize(int32 Side) { return Side < PosZ ? CHUNK_SIZE_Z : CHUNK_SIZE_X; }
+    static FORCEINLINE int32 Opposite(int32 Side) { return Side ^ 1; }
+    static FChunkKey GetNeighborKey(const FChunkKey& Key, int32 Side);
+
+    FORCEINLINE bool HasSide(int32 Side) const { return Slabs[Side].Num() > 0; }
+
+    // Bit per side that has a slab.
+    uint8 GetAvailableMask() const;
+
+    // Copy the layer of Neighbor that touches Side of the chunk being meshed.
+    void CaptureSide(int32 Side, const FVoxelChunkData& Neighbor);
+
+    // True if the cell just across Side (at Along, Y) is air, or assumed air.
+    FORCEINLINE bool IsAirAcross(int32 Side, int32 Along, int32 Y) const
+    {
+        if (!HasSide(Side)) return !bMissingIsSolid;
+        return Slabs[Side][Along + Y * AlongSize(Side)] == static_cast<uint8>(EBlockId::Air);
+    }
+
+    // The slabs as kernel input; valid while this object is unchanged.
+    VoxelKernel::FBorderView MakeView() const
+    {
+        VoxelKernel::FBorderView View;
+        for (int32 Side = 0; Side < NumSides; ++Side)
+        {
+            View.Slabs[Side] = HasSide(Side) ? Slabs[Side].GetData() : nullptr;
+        }
+        View.bMissingIsSolid = bMissingIsSolid;
+        return View;
+    }
+};
 
 /**
  * Naive mesher that emits visible faces only.
@@ -15,6 +76,8 @@ class FVoxelMesher_Naive
 public:
     /** Build mesh arrays from the chunk.
      * BlockSize = size of one cube along each axis in Unreal units (e.g. 100)
+     * Borders = optional neighbor layers; without them every side of the chunk counts as air.
+     * SectionIndex = vertical section to mesh (see CHUNK_SECTION_SIZE_Y), or INDEX_NONE for the whole chunk.
      */
     static void BuildMesh(const FVoxelChunkData& Chunk, float BlockSize,
         TArray<FVector>& OutVertices,
@@ -22,12 +85,70 @@ public:
         TArray<FVector>& OutNormals,
         TArray<FVector2D>& OutUVs,
         TArray<FLinearColor>& OutColors,
-        TArray<FProcMeshTangent>& OutTangents);
+        TArray<FProcMeshTangent>& OutTangents,
+        const FVoxelChunkBorders* Borders = nullptr,
+        int32 SectionIndex = INDEX_NONE);
+
+    /** Build straight into a procedural mesh section (vertex structs, index buffer, local bounds).
+     * Intended for worker threads: the result can be moved into the component without conversion.
+     * Render only (bEnableCollision = false); see BuildCollisionSection.
+     */
+    static void BuildMeshSection(const FVoxelChunkData& Chunk, float BlockSize, FProcMeshSection& OutSection,
+        const FVoxelChunkBorders* Borders = nullptr, int32 SectionIndex = INDEX_NONE);
+
+    /** Collision-only section (hidden, bEnableCollision = true): the same visible faces, greedy-merged into
+     * rectangles per face direction and layer regardless of block type. Positions and normals only.
+     */
+    static void BuildCollisionSection(const FVoxelChunkData& Chunk, float BlockSize, FProcMeshSection& OutSection,
+        const FVoxelChunkBorders* Borders = nullptr, int32 SectionIndex = INDEX_NONE);
+
+    /** Build packed vertices only (4 per quad, indices implied). Independent of BlockSize.
+     * OutVoxelBounds = corner bounds in voxel units, world axis order (invalid when nothing is visible).
+     */
+    static void BuildPackedMesh(const FVoxelChunkData& Chunk, TArray<FVoxelPackedVertex>& OutVertices, FBox& OutVoxelBounds,
+        const FVoxelChunkBorders* Borders = nullptr, int32 SectionIndex = INDEX_NONE);
+
+    /** Sections touched by an edit at local Y: its own, plus the one across when Y sits on a section boundary. */
+    static uint32 GetSectionMaskForCellY(int32 Y);
+
+    /** Far-distance mesh at LOD 1..VOXEL_MAX_LOD, render only (bEnableCollision = false).
+     * Top-surface sampling: each (1 << LOD)^2 block of columns becomes one column at its highest non-air cell,
+     * with side quads between columns and short skirts on the chunk edges that hide cracks against
+     * neighbors meshed at another level.
+     */
+    static void BuildLODMeshSection(const FVoxelChunkData& Chunk, float BlockSize, int32 LOD, FProcMeshSection& OutSection);
+
+    /** Same LOD mesh as packed vertices (corners stay on the voxel grid, so the packed format holds them). */
+    static void BuildLODPackedMesh(const FVoxelChunkData& Chunk, int32 LOD, TArray<FVoxelPackedVertex>& OutVertices, FBox& OutVoxelBounds);
+
+    /** Flat attributes for non-voxel geometry (far terrain): atlas tile center UV + block tint. */
+    static void GetSurfaceAttributes(EBlockId Id, FVector2D& OutUV, FLinearColor& OutColor);
+
+    /** Expand one packed vertex into render attributes (used by UVoxelChunkComponent's proxy). */
+    static void DecodePackedVertex(const FVoxelPackedVertex& Packed, float BlockSize,
+        FVector3f& OutPosition, FVector3f& OutNormal, FVector3f& OutTangent, FVector2f& OutUV, FColor& OutColor);
 
 private:
+    // Culling walk: calls EmitCellFace(X, Y, Z, Face, Id) for every solid cell face that borders air.
+    template <typename CellFaceFunc>
+    static void ForEachVisibleCellFace(const FVoxelChunkData& Chunk, const FVoxelChunkBorders* Borders, int32 SectionIndex, CellFaceFunc&& EmitCellFace);
+
+    // Shared face walk: calls EmitFace(A, B, C, D, Normal, UVs[4], Color) for every visible quad.
+    template <typename FaceFunc>
+    static void ForEachVisibleFace(const FVoxelChunkData& Chunk, float BlockSize, const FVoxelChunkBorders* Borders, int32 SectionIndex, FaceFunc&& EmitFace);
+
+    // LOD walk: calls EmitQuad(Corners[4], Face, Id) with corners in voxel units (X, Y vertical, Z), FaceCorners order.
+    template <typename QuadFunc>
+    static void ForEachLODQuad(const FVoxelChunkData& Chunk, int32 LOD, QuadFunc&& EmitQuad);
+
     // helper: returns true if neighbor at world-local (x+nx,y+ny,z+nz) is empty (air)
     static bool IsAirNeighbor(const FVoxelChunkData& Chunk, int32 X, int32 Y, int32 Z, int32 NX, int32 NY, int32 NZ);
 
     // Simple atlas mapping: returns bottom-left UV and tile size (uTile,vTile)
     static void GetAtlasUVForBlock(EBlockId Id, FVector2D& OutUV0, FVector2D& OutTileSize);
+    static uint8 GetAtlasSlotForBlock(EBlockId Id);
+    static void GetAtlasUVForSlot(uint8 Slot, FVector2D& OutUV0, FVector2D& OutTileSize);
+    static FVector2D GetAtlasCornerUV(uint8 Slot, EVoxelFace Face, int32 Corner);
+
+    static FLinearColor GetBlockColor(EBlockId Id);
 };
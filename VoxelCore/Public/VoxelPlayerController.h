@@ -7,13 +7,40 @@
 #include "VoxelPlayerController.generated.h"
 
 class AVoxelWorldManager;
+struct FChunkKey;
+
+/** Server: what became of an edit the admission queue let through. */
+enum class EVoxelEditOutcome : uint8
+{
+	Applied,
+	Unchanged,   // the cell already had that id
+	Invalid,     // failed validation (reach, no hit, ...)
+	Duplicate,   // the cell was already set to the same id in this drain
+};
+
+/** Chunk X, chunk Z, local index. */
+using FVoxelEditedCell = TTuple<int32, int32, int32>;
+
+/** Server: cells applied in one edit drain, with the id each was last set to. */
+using FVoxelEditedCells = TMap<FVoxelEditedCell, uint8>;
 
 /**
  * C++ base for BP_FirstPersonPlayerController.
  * - Client sends Server_RequestBlockEdit(FBlockEditRequest)  [single-op path]
- * - Server resolves & applies on the authoritative world manager
- * - Server broadcasts a compact op to all clients
- * - Client applies op to its client-visual world manager
+ *   or Server_RequestBlockEdits(TArray)  [batched; QueueBlockEditRequest sends one per tick]
+ * - Server admits requests through a per-player token bucket into the world manager's edit queue, which
+ *   resolves & applies them under a per-tick time budget (one rebuild per touched chunk per tick)
+ * - Every server edit bumps its chunk's delta sequence. Clients that stream the chunk get the new ops as
+ *   sequenced chunk deltas, coalesced once per tick (Client_ApplyChunkDeltas); this is the only path edits
+ *   take to client visuals.
+ * - A client subscribes to a chunk when it streams in (Server_RequestChunkDeltas with the sequence and content
+ *   hash it has) and gets only what it is missing; a sequence gap makes it ask again.
+ * - Remote clients predict their own queued edits on the client-visual manager. The server answers each with
+ *   the chunk sequence carrying it (Client_ResolveEditPredictions); the prediction is dropped once that
+ *   sequence is applied, or right away if the server changed nothing.
+ * - With AVoxelWorldManager::bStreamChunkContents, the client-visual manager asks for each chunk's generated
+ *   blocks (Server_RequestChunkContents, with the content hash of any cached copy) instead of generating them.
+ *   The server answers nearest first under MaxContentBytesPerSecond; a matching hash costs no payload.
  */
 UCLASS(Blueprintable)
 class VOXELCORE_API AVoxelPlayerController : public APlayerController
@@ -25,10 +52,42 @@ public:
 	void Server_RequestBlockEdit(const FBlockEditRequest& Req);
 	void Server_RequestBlockEdit_Implementation(const FBlockEditRequest& Req);
 
-	/** Server → Client broadcast (single op to peers) */
+	/** Client → Server request (many edits, admitted in order). At most MaxEditsPerBatch are honored per call,
+	 *  and each still spends an edit token: a batch larger than the tokens left loses its tail. */
+	UFUNCTION(Server, Reliable)
+	void Server_RequestBlockEdits(const TArray<FBlockEditRequest>& Reqs);
+	void Server_RequestBlockEdits_Implementation(const TArray<FBlockEditRequest>& Reqs);
+
+	/** Owning client: queue an edit; all edits queued during a frame go out as one Server_RequestBlockEdits. */
+	UFUNCTION(BlueprintCallable, Category = "Voxel|Edits")
+	void QueueBlockEditRequest(const FBlockEditRequest& Req);
+
+	static constexpr int32 MaxEditsPerBatch = 128;
+	static constexpr int32 MaxDeltaBytesPerRPC = 8 * 1024;
+	static constexpr int32 MaxOpsPerDeltaPart = 1024;
+	static constexpr int32 MaxContentRequestsPerRPC = 256;
+	static constexpr int32 MaxContentBytesPerRPC = 16 * 1024;
+	static constexpr int32 MaxPendingContentRequests = 8192;
+
+	/** Server → Client: chunk deltas queued since the last tick, in sequence order per chunk */
+	UFUNCTION(Client, Reliable)
+	void Client_ApplyChunkDeltas(const TArray<FVoxelChunkDelta>& Deltas);
+	void Client_ApplyChunkDeltas_Implementation(const TArray<FVoxelChunkDelta>& Deltas);
+
+	/** Server → Client: outcome of the client's predicted edits */
+	UFUNCTION(Client, Reliable)
+	void Client_ResolveEditPredictions(const TArray<FVoxelEditPredictionAck>& Acks);
+	void Client_ResolveEditPredictions_Implementation(const TArray<FVoxelEditPredictionAck>& Acks);
+
+	/** Owning client → server: generated contents for these chunks (answered over later ticks, nearest first) */
+	UFUNCTION(Server, Reliable)
+	void Server_RequestChunkContents(const TArray<FVoxelChunkContentRequest>& Requests);
+	void Server_RequestChunkContents_Implementation(const TArray<FVoxelChunkContentRequest>& Requests);
+
+	/** Server → Client: answers to Server_RequestChunkContents */
 	UFUNCTION(Client, Reliable)
-	void Client_ApplyRemoteBlockEdit(const FBlockEditOp& Op);
-	void Client_ApplyRemoteBlockEdit_Implementation(const FBlockEditOp& Op);
+	void Client_ReceiveChunkContents(const TArray<FVoxelChunkContent>& Contents);
+	void Client_ReceiveChunkContents_Implementation(const TArray<FVoxelChunkContent>& Contents);
 
 	/** BP sets this to the client-visual world manager it spawns/owns. */
 	UPROPERTY(BlueprintReadWrite, Category = "Voxel")
@@ -38,10 +97,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel")
 	void SetClientVisualManager(AVoxelWorldManager* Mgr) { ClientVisualManager = Mgr; }
 
-	/** Ask server for one specific chunk's snapshot (authoritative modified cells) */
+	/** Subscribe to a chunk's deltas; the server replies only if Version (sequence + content hash) is behind.
+	 *  Chunks beyond streaming range of the pawn (RenderRadiusChunks + 1 from its chunk) are ignored. */
 	UFUNCTION(Server, Reliable)
-	void Server_RequestChunkSnapshot(FIntPoint ChunkXZ);
-	void Server_RequestChunkSnapshot_Implementation(FIntPoint ChunkXZ);
+	void Server_RequestChunkDeltas(const FVoxelChunkVersion& Version);
+	void Server_RequestChunkDeltas_Implementation(const FVoxelChunkVersion& Version);
 
 	// ---- BP-friendly wrappers (late-join/area snapshot) ----
 	UFUNCTION(BlueprintCallable, Category = "Voxels|Net")
@@ -50,24 +110,135 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxels|Net")
 	void RequestChunkSnapshotsForAreaBP(FIntPoint CenterChunk, int32 Radius);
 
-	/** Owning client → server: request initial snapshots around pawn */
+	/** Owning client → server: request initial snapshots around pawn (Known as for the area request, and bounded the same way) */
 	UFUNCTION(Server, Reliable)
-	void Server_RequestInitialChunkSnapshots();
+	void Server_RequestInitialChunkSnapshots(const TArray<FVoxelChunkVersion>& Known);
 
-	/** Server helper: request snapshots for a specific area (center/radius in chunk space) */
+	/** Server helper: request snapshots for a specific area (center/radius in chunk space).
+	 *  Known lists the client's loaded chunks with what it holds of them; only those that differ get a reply.
+	 *  Chunks the client hasn't loaded subscribe themselves when they stream in.
+	 *  The area is clamped to streaming range of the pawn (RenderRadiusChunks + 1 from its chunk), and a Known list
+	 *  longer than that whole range holds is ignored. */
 	UFUNCTION(Server, Reliable)
-	void Server_RequestChunkSnapshotsForArea(FIntPoint CenterChunk, int32 Radius);
+	void Server_RequestChunkSnapshotsForArea(FIntPoint CenterChunk, int32 Radius, const TArray<FVoxelChunkVersion>& Known);
 
-	/** Server → client: push a snapshot (list of modified ops) for a chunk */
-	UFUNCTION(Client, Reliable)
-	void Client_ReceiveChunkSnapshot(FIntPoint ChunkXZ, const TArray<FBlockEditOp>& Ops);
-	void Client_ReceiveChunkSnapshot_Implementation(FIntPoint ChunkXZ, const TArray<FBlockEditOp>& Ops);
+	/** Owning client → server: these chunks left the client's streamed set (edits for them stop being sent). */
+	UFUNCTION(Server, Reliable)
+	void Server_ReportChunksUnloaded(const TArray<FIntPoint>& Chunks);
+	void Server_ReportChunksUnloaded_Implementation(const TArray<FIntPoint>& Chunks);
+
+	/** Server: does this client stream the chunk (has subscribed and not unloaded it since)? */
+	bool IsChunkStreamedByClient(const FIntPoint& ChunkXZ) const;
+
+	/** Off = every edit goes to every client (no interest management). */
+	UPROPERTY(EditDefaultsOnly, Category = "Voxels|Net")
+	bool bFilterEditsByStreamedChunks = true;
+
+	/** Encoded delta bytes sent to this client per second (0 = unlimited); large deltas go out in parts over several ticks. */
+	UPROPERTY(EditDefaultsOnly, Category = "Voxels|Net", meta = (ClampMin = "0"))
+	int32 MaxDeltaBytesPerSecond = 64 * 1024;
+
+	/** Streamed chunk content bytes sent to this client per second (0 = unlimited). */
+	UPROPERTY(EditDefaultsOnly, Category = "Voxels|Net", meta = (ClampMin = "0"))
+	int32 MaxContentBytesPerSecond = 256 * 1024;
+
+	/** Remote clients show their own edits before the server confirms them. */
+	UPROPERTY(EditDefaultsOnly, Category = "Voxels|Net")
+	bool bPredictEdits = true;
+
+	/** Server: edits a player may request per second (0 = unlimited); requests without a token are dropped.
+	 *  Batched edits are charged one token each like single ones, so bulk tools (fills, brushes) are held to
+	 *  this rate too: raise it, or set it to 0 for trusted players, if they must land whole. */
+	UPROPERTY(EditDefaultsOnly, Category = "Voxel|Edits", meta = (ClampMin = "0"))
+	float EditTokensPerSecond = 20.f;
+
+	/** Server: edits a player may request at once after being idle (token bucket size). Below MaxEditsPerBatch,
+	 *  a full Server_RequestBlockEdits batch can't be admitted whole even from idle. */
+	UPROPERTY(EditDefaultsOnly, Category = "Voxel|Edits", meta = (ClampMin = "1"))
+	float EditTokenBurst = 40.f;
 
-	// Throttle per-chunk snapshot requests after receiving edits (client-side safety net)
-	UPROPERTY()
-	TMap<FIntPoint, float> NextSnapshotAllowedTime;
+	/** Server: how far a request's TraceStart (the client's camera) may lie from the pawn's eyes. The server traces
+	 *  from TraceStart, as the client did, once a voxel ray from the eyes reaches it unblocked; a start further off,
+	 *  or behind a wall, rejects the request. Cover the longest camera boom the game uses. */
+	UPROPERTY(EditDefaultsOnly, Category = "Voxel|Edits", meta = (ClampMin = "0"))
+	float EditTraceStartTolerance = 600.f;
+
+	/** Server: resolve, apply and broadcast an admitted edit and answer its prediction. Last write wins: a cell
+	 *  CellsThisTick already holds at the same id is a duplicate and left alone, any other id is applied. Only
+	 *  edits that changed their cell are recorded. */
+	EVoxelEditOutcome ApplyAdmittedEdit_Server(AVoxelWorldManager& ServerMgr, const FBlockEditRequest& Req, FVoxelEditedCells& CellsThisTick);
+
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void PlayerTick(float DeltaTime) override;
 
 protected:
 	/** Find the authoritative (server) world manager without touching its internals. */
 	AVoxelWorldManager* GetAuthoritativeWorldManager() const;
+
+	/** Server: validate a request against authoritative data and resolve the cell it edits. */
+	bool ResolveEditRequest_Server(AVoxelWorldManager& ServerMgr, const FBlockEditRequest& Req, FChunkKey& OutKey, int32& OutLocalIndex) const;
+
+	/** Server: spend a token and queue Req on the world manager; a dropped request answers its prediction with 0. */
+	void AdmitEdit_Server(AVoxelWorldManager* ServerMgr, const FBlockEditRequest& Req);
+
+	/** Server: queue the answer to a predicted edit (no-op for PredictionId 0). */
+	void AckEditPrediction_Server(int32 PredictionId, int32 Seq);
+
+	/** Owning client: show Req on the client-visual manager and tag it; false if its target can't be found locally. */
+	bool PredictEdit_Client(FBlockEditRequest& Req);
+
+	/** Server: queue a delta for this client's next Client_ApplyChunkDeltas. */
+	void QueueChunkDelta(FVoxelChunkDelta&& Delta);
+
+	/** Client-visual manager, found lazily if BP didn't wire it. */
+	AVoxelWorldManager* ResolveClientVisualManager();
+
+	/** Owning client: versions of the loaded chunks within Radius of CenterChunk (Radius < 0 = all). */
+	void GatherKnownChunkVersions(const FIntPoint& CenterChunk, int32 Radius, TArray<FVoxelChunkVersion>& OutKnown);
+
+	void FlushQueuedEditRequests();
+	void FlushChunkDeltas(float DeltaSeconds);
+	void FlushPredictionAcks();
+	void FlushChunkContents(float DeltaSeconds);
+
+	/** Server: chunk under this client's pawn (or view target); false if it has neither. */
+	bool GetViewChunk_Server(const AVoxelWorldManager& ServerMgr, FIntPoint& OutChunk) const;
+
+private:
+	/** Owning client: requests waiting for this frame's Server_RequestBlockEdits */
+	TArray<FBlockEditRequest> QueuedEditRequests;
+
+	/** Server: chunks this client streams; filled by subscriptions, emptied by Server_ReportChunksUnloaded */
+	TSet<FIntPoint> StreamedChunks;
+
+	/** Server: deltas waiting for this client's next broadcast */
+	TArray<FVoxelChunkDelta> PendingChunkDeltas;
+
+	/** Server: merged, split and encoded deltas waiting for byte budget */
+	TArray<FVoxelChunkDelta> OutgoingChunkDeltas;
+
+	/** Server: bytes that may still be sent (token bucket, refilled every tick, at most one second's worth) */
+	float DeltaByteAllowance = 0.f;
+
+	/** Server: chunks whose contents this client asked for, with the hash of its cached copy */
+	TMap<FIntPoint, uint32> PendingContentRequests;
+
+	/** Server: content bytes that may still be sent (like DeltaByteAllowance) */
+	float ContentByteAllowance = 0.f;
+
+	/** Owning client: parts received so far of deltas sent with bMore */
+	TMap<FIntPoint, FVoxelChunkDelta> PartialChunkDeltas;
+
+	/** Server: edit token bucket (EditTokens < 0 = not started: full) */
+	float EditTokens = -1.f;
+	double EditTokensTime = 0.0;
+
+	/** Server: answers to this client's predicted edits, sent once per tick */
+	TArray<FVoxelEditPredictionAck> PendingPredictionAcks;
+
+	/** Owning client: id for the next predicted edit */
+	int32 NextPredictionId = 1;
+
+	/** Owning client: chunks with a resubscribe in flight after a sequence gap */
+	TSet<FIntPoint> ResyncRequested;
 };
@@ -67,6 +67,37 @@ struct FBlockEditRequest
 
 	/** Client-claimed reach (server revalidates/clamps). */
 	UPROPERTY(BlueprintReadWrite) float ClaimedReach = 400.f;
+
+	/** Ray the client aimed with (required: a request without TraceDirection is rejected). The server re-runs the
+	 *  voxel raycast on its own data from TraceStart along TraceDirection and ignores WorldHitLocation/HitNormal.
+	 *  TraceStart must be in line of sight of the pawn's eyes and within AVoxelPlayerController::EditTraceStartTolerance. */
+	UPROPERTY(BlueprintReadWrite) FVector TraceStart = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadWrite) FVector TraceDirection = FVector::ZeroVector;
+
+	/** Set by the owning client when it shows the edit before the server answers (0 = not predicted). */
+	UPROPERTY() int32 PredictionId = 0;
+};
+
+/** Result of AVoxelWorldManager::VoxelRaycast (grid walk over loaded chunk data, no collision needed). */
+USTRUCT(BlueprintType)
+struct FVoxelRayHit
+{
+	GENERATED_BODY()
+
+	/** Solid cell that was hit. */
+	UPROPERTY(BlueprintReadOnly) FIntPoint ChunkXZ = FIntPoint(0, 0);
+	UPROPERTY(BlueprintReadOnly) int32 LocalIndex = 0;
+	UPROPERTY(BlueprintReadOnly) int32 BlockId = 0;
+
+	/** Empty cell the ray passed through just before the hit (placement target). False if the ray started inside the hit cell. */
+	UPROPERTY(BlueprintReadOnly) bool bHasPreviousCell = false;
+	UPROPERTY(BlueprintReadOnly) FIntPoint PreviousChunkXZ = FIntPoint(0, 0);
+	UPROPERTY(BlueprintReadOnly) int32 PreviousLocalIndex = 0;
+
+	/** Where the ray entered the cell, the outward normal of that face (world axes) and the distance from the start. */
+	UPROPERTY(BlueprintReadOnly) FVector WorldHitLocation = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadOnly) FVector HitNormal = FVector::ZeroVector;
+	UPROPERTY(BlueprintReadOnly) float Distance = 0.f;
 };
 
 /** Server → Clients compact op: identifies a single edited cell and result. */
@@ -84,3 +115,125 @@ struct FBlockEditOp
 	/** Resulting block id (int value of EBlockId). */
 	UPROPERTY(BlueprintReadWrite) int32 NewBlockId = 0;
 };
+
+/** Client → Server: what a client holds of a chunk (delta sequence and FVoxelChunkData::ComputeModifiedHash). */
+USTRUCT()
+struct FVoxelChunkVersion
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FIntPoint ChunkXZ = FIntPoint(0, 0);
+	UPROPERTY() int32 Seq = 0;
+	UPROPERTY() uint32 Hash = 0;
+};
+
+/** Server edit admission counters (AVoxelWorldManager::GetEditAdmissionStats). Counts are since BeginPlay. */
+USTRUCT(BlueprintType)
+struct FVoxelEditAdmissionStats
+{
+	GENERATED_BODY()
+
+	/** Accepted into the server queue. */
+	UPROPERTY(BlueprintReadOnly) int32 Admitted = 0;
+	/** Dropped because the player was out of edit tokens. */
+	UPROPERTY(BlueprintReadOnly) int32 RejectedRateLimit = 0;
+	/** Dropped because the server queue was full. */
+	UPROPERTY(BlueprintReadOnly) int32 RejectedQueueFull = 0;
+	/** Repeated an edit already applied to the same cell, with the same id, in the same drain. */
+	UPROPERTY(BlueprintReadOnly) int32 Deduplicated = 0;
+	/** Failed validation (reach, no hit, ...). */
+	UPROPERTY(BlueprintReadOnly) int32 Invalid = 0;
+	/** Changed a cell. */
+	UPROPERTY(BlueprintReadOnly) int32 Applied = 0;
+	UPROPERTY(BlueprintReadOnly) int32 QueueDepth = 0;
+	UPROPERTY(BlueprintReadOnly) int32 PeakQueueDepth = 0;
+};
+
+/** Server → Client: outcome of a predicted edit. Seq is the chunk sequence that carries it, 0 if nothing changed. */
+USTRUCT()
+struct FVoxelEditPredictionAck
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 PredictionId = 0;
+	UPROPERTY() int32 Seq = 0;
+};
+
+/** One cell in a chunk delta (the chunk is on the delta). */
+USTRUCT()
+struct FVoxelCellOp
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 LocalIndex = 0;
+	UPROPERTY() uint8 BlockId = 0;
+};
+
+/**
+ * Server → Client: the chunk's changes from sequence FromSeq to ToSeq (latest value per cell).
+ * Each server edit of a chunk bumps its sequence by one. With bReset, Ops is the chunk's whole modified set
+ * at ToSeq and every other cell is back to its generated value.
+ * Large deltas go out in parts over several frames: every part but the last has bMore set.
+ * On the wire Ops is a VoxelDeltaCodec payload (see NetSerialize).
+ */
+USTRUCT()
+struct FVoxelChunkDelta
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FIntPoint ChunkXZ = FIntPoint(0, 0);
+	UPROPERTY() int32 FromSeq = 0;
+	UPROPERTY() int32 ToSeq = 0;
+	UPROPERTY() bool bReset = false;
+	UPROPERTY() bool bMore = false;
+	UPROPERTY() TArray<FVoxelCellOp> Ops;
+
+	/** Sender-side cache of the encoded Ops (filled when sizing the send; encoded on the fly when empty). */
+	TArray<uint8> EncodedOps;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FVoxelChunkDelta> : public TStructOpsTypeTraitsBase2<FVoxelChunkDelta>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/** Client → Server: asks for a chunk's generated contents. Hash is FVoxelChunkData::ComputeBlocksHash of the copy the client has cached (0 = none). */
+USTRUCT()
+struct FVoxelChunkContentRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FIntPoint ChunkXZ = FIntPoint(0, 0);
+	UPROPERTY() uint32 Hash = 0;
+};
+
+/**
+ * Server → Client: a chunk's generated contents (FVoxelChunkData::Blocks, without edits) as a
+ * VoxelDeltaCodec::EncodeBlocks payload. An empty Payload means the client's cached copy (Hash) is current.
+ */
+USTRUCT()
+struct FVoxelChunkContent
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FIntPoint ChunkXZ = FIntPoint(0, 0);
+	UPROPERTY() uint32 Hash = 0;
+	UPROPERTY() TArray<uint8> Payload;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FVoxelChunkContent> : public TStructOpsTypeTraitsBase2<FVoxelChunkContent>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
@@ -1,15 +1,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/LruCache.h"
 #include "GameFramework/Actor.h"
 #include "ProceduralMeshComponent.h"
 #include "ChunkHelpers.h"
 #include "VoxelChunk.h"
 #include "VoxelTypes.h"
+#include "VoxelMesher.h"
 #include "VoxelWorldManager.generated.h"
 
 class AVoxelChunkActor;
-class AVoxelChunkNetState;
+class AVoxelFarTerrainActor;
+class AVoxelPlayerController;
 
 UENUM(BlueprintType)
 enum class EVoxelWorldSize : uint8
@@ -19,20 +22,47 @@ enum class EVoxelWorldSize : uint8
     Large  UMETA(DisplayName = "Large")
 };
 
-// Off-thread result: mesh buffers + data.
+// How border faces are meshed while the adjacent chunk is not loaded yet.
+UENUM(BlueprintType)
+enum class EVoxelMissingNeighborPolicy : uint8
+{
+    EmitFaces UMETA(DisplayName = "Treat As Air (emit border faces)"),
+    CullFaces UMETA(DisplayName = "Treat As Solid (cull border faces)")
+};
+
+// Off-thread result: ready-to-upload mesh sections + data.
+// Sections are moved into the chunk actor on drain, so they are empty afterwards.
 struct FChunkMeshResult
 {
     FChunkKey Key;
     float     BlockSize = 100.f;
 
+    // 0 = full-resolution chunk; 1..VOXEL_MAX_LOD = far LOD mesh in Sections[0] (Data is not kept).
+    int32 LOD = 0;
+
     TSharedPtr<FVoxelChunkData> Data;
 
-    TArray<FVector>          V;
-    TArray<int32>            I;
-    TArray<FVector>          N;
-    TArray<FVector2D>        UV;
-    TArray<FLinearColor>     C;
-    TArray<FProcMeshTangent> T;
+    // One entry per vertical section (CHUNK_NUM_SECTIONS); only the ones in SectionMask were built.
+    uint32 SectionMask = CHUNK_ALL_SECTIONS;
+    TArray<FProcMeshSection> Sections;
+
+    // FVoxelChunkBorders sides that were available when the build was kicked.
+    uint8 NeighborMask = 0;
+
+    // Packed render path only (bUsePackedChunkRendering); Sections are then left empty.
+    bool bPacked = false;
+    TArray<TArray<FVoxelPackedVertex>> PackedSections;
+    TArray<FBox> PackedVoxelBounds;
+
+    // Greedy collision sections built for CollisionMask (0 = chunk outside the collision radius).
+    uint32 CollisionMask = 0;
+    TArray<FProcMeshSection> CollisionSections;
+
+    // Collision for a chunk that entered the collision radius; carries no render data.
+    bool bCollisionOnly = false;
+
+    // Client visual: sequence of the cached edits generated into Data (INDEX_NONE = no cache used).
+    int32 CachedEditSeq = INDEX_NONE;
 };
 
 USTRUCT()
@@ -43,6 +73,23 @@ struct FChunkRecord
     TSharedPtr<FVoxelChunkData>      Data;
     TWeakObjectPtr<AVoxelChunkActor> Actor;
     bool bDirty = false;
+
+    // Vertical sections to rebuild once the in-flight build lands (valid while bDirty).
+    uint32 DirtySections = 0;
+
+    // Neighbor sides the current mesh was built against (see FVoxelChunkBorders).
+    uint8 MeshedNeighborMask = 0;
+
+    // The actor holds collision sections (chunk is within CollisionRadiusChunks of a pawn).
+    bool bHasCollision = false;
+};
+
+// Far chunk shown at a downsampled LOD. Holds no voxel data; it is rebuilt from the generator (+ deltas) on demand.
+struct FLODChunkRecord
+{
+    TWeakObjectPtr<AVoxelChunkActor> Actor;
+    int32 LOD = 0;          // level currently on screen (0 = nothing yet)
+    int32 DesiredLOD = 0;   // level the streaming rings want
 };
 
 // ---- Net structs for replication of edits ----
@@ -115,9 +162,6 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel|Config")
     void ClearTrackedActors();
 
-    // Called by AVoxelChunkNetState on clients when cells replicate or change.
-    void IngestReplicatedCells(const FIntPoint& ChunkXZ, const TArray<struct FModifiedCell>& Cells);
-
     // Coordinate helpers
     bool WorldToVoxel_ForEdit(const FVector& World, FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const;
     bool WorldToVoxel_Centered(const FVector& World, FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const;
@@ -129,6 +173,25 @@ public:
         int32& OutLocalIndex,
         FString& OutFail) const;
 
+    // Walk the voxel grid from Start (Amanatides-Woo DDA) up to MaxDistance and report the first solid cell.
+    // Reads loaded chunk data only: stops (no hit) at a chunk that isn't loaded, or below the world.
+    UFUNCTION(BlueprintCallable, Category = "Voxel|Query")
+    bool VoxelRaycast(const FVector& Start, const FVector& Direction, float MaxDistance, FVoxelRayHit& OutHit) const;
+
+    // ---- Box queries against the voxel grid (no chunk collision needed) ----
+    // Boxes are world-space center + half extent. Unloaded chunks and the space below the world block.
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel|Query")
+    bool VoxelOverlapBox(const FVector& Center, const FVector& Extent) const;
+
+    // First blocking contact along Delta: OutTime in [0, 1] and the face normal (world axes). False if the path is clear.
+    bool VoxelSweepBox(const FVector& Center, const FVector& Extent, const FVector& Delta, float& OutTime, FVector& OutNormal) const;
+
+    // Move along Delta one axis at a time (vertical first), stopping each axis at the first blocking layer:
+    // the usual voxel slide. Returns the applied offset; OutBlockedAxes has bit 1 << axis (0 = X, 1 = Y, 2 = Z)
+    // set for every axis that was cut short.
+    FVector VoxelSlideBox(const FVector& Center, const FVector& Extent, const FVector& Delta, uint8& OutBlockedAxes) const;
+
     UFUNCTION(BlueprintCallable, Category = "Voxel|Edits")
     bool ApplyVisualBlockEdit_ClientBP(FIntPoint ChunkXZ, int32 LocalIndex, int32 NewBlockId);
 
@@ -136,7 +199,13 @@ public:
         int32 LocalIndex,
         int32 NewBlockId,
         TArray<FChunkKey>& OutChunksNeedingRebuild,
-        FString& OutFail);
+        FString& OutFail,
+        int32* OutSeq = nullptr);   // the chunk's new delta sequence, 0 if the cell already had that id
+
+    // Server edit batches: between Begin/End, ApplyBlockEdit_Server only changes data and the rebuilds are
+    // kicked once per touched chunk (and border neighbor) by the outermost EndEditBatch. Nests.
+    void BeginEditBatch();
+    void EndEditBatch();
 
     // Apply a batch of ops to a chunk if loaded; otherwise queue them for when it loads.
     void ApplyOrQueueClientOps(FIntPoint ChunkXZ, const TArray<FBlockEditOp>& Ops);
@@ -147,11 +216,84 @@ public:
     // Server-side: gather the authoritative modified blocks for a chunk as ops.
     bool GetChunkModifiedOps_Server(const FChunkKey& Key, TArray<FBlockEditOp>& OutOps);
 
+    // ---- Sequenced chunk deltas ----
+    // Server: what a client holding Version (sequence + content hash) is missing. Recent ops if the log still
+    // has them; if the client's content matches, just the current sequence; else a reset to the whole modified
+    // set. False when the client is up to date or the chunk can't be loaded.
+    bool BuildChunkDelta_Server(const FChunkKey& Key, const FVoxelChunkVersion& Version, FVoxelChunkDelta& OutDelta);
+
+    // Client visual: apply a delta (or queue it until the chunk loads). False on a sequence gap: nothing was
+    // applied and the client should ask again from GetClientChunkVersion. Deltas for chunks that are neither
+    // loaded nor loading are dropped (the chunk resubscribes when it streams in).
+    bool ApplyChunkDelta(const FVoxelChunkDelta& Delta);
+    int32 GetClientDeltaSeq(const FIntPoint& ChunkXZ) const;
+    FVoxelChunkVersion GetClientChunkVersion(const FIntPoint& ChunkXZ) const;
+
+    // ---- Client edit prediction ----
+    // Client visual: show an edit right away as a tentative overlay tagged with PredictionId. Server deltas for
+    // the cell update the value underneath it until ResolvePrediction settles it. False if the chunk isn't loaded.
+    bool PredictBlockEdit(const FIntPoint& ChunkXZ, int32 LocalIndex, uint8 BlockId, int32 PredictionId);
+
+    // Client visual: the server's answer to a prediction. Seq 0 = nothing changed on the server (rejected or
+    // a no-op): the server's value shows again now. Otherwise the overlay goes once the chunk reaches Seq.
+    void ResolvePrediction(int32 PredictionId, int32 Seq);
+
+    // Keys of chunks whose data is loaded.
+    void GetLoadedChunkKeys(TArray<FChunkKey>& OutKeys) const;
+
+    // ---- Streamed chunk contents ----
+    // Client visual: chunks start from generated blocks sent by the server (AVoxelPlayerController::
+    // Server_RequestChunkContents) instead of running FVoxelGenerator; edits still arrive as chunk deltas.
+    // Contents are cached by content hash, and a chunk whose cached copy the server has confirmed this session
+    // is never asked for again. Far LOD rings and the horizon still sample the generator (turn them off to avoid it).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Net", meta = (ExposeOnSpawn = "true"))
+    bool bStreamChunkContents = false;
+
+    // Client visual: streamed contents kept (encoded) for chunks streaming back in; least recently used go first.
+    // Read at BeginPlay.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Net", meta = (ClampMin = "1"))
+    int32 MaxCachedChunkContents = 4096;
+
+    // Server: encoded contents kept for answering further requests; least recently served go first. Read at BeginPlay.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Net", meta = (ClampMin = "1"))
+    int32 MaxServedChunkContents = 4096;
+
+    // Server: Key's generated blocks, encoded (shared between clients, never modified). False while they are
+    // still being generated/encoded off-thread: ask again on a later tick.
+    bool GetChunkContent_Server(const FChunkKey& Key, uint32& OutHash, TSharedPtr<const TArray<uint8>>& OutPayload);
+
+    // Client visual: contents the server sent (an empty payload confirms the cached copy with Content.Hash).
+    void ReceiveChunkContent(const FVoxelChunkContent& Content);
+
+    // ---- Server edit admission ----
+    // Player edits are not applied inside the RPC: they wait in one server-wide queue that Tick drains under
+    // EditDrainBudgetMs, as one edit batch per tick. False (and counted) if the queue is full.
+    bool EnqueueEdit_Server(AVoxelPlayerController* Requester, const FBlockEditRequest& Req);
+    void NoteEditRateLimited_Server() { ++EditStats.RejectedRateLimit; }
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel|Edits")
+    FVoxelEditAdmissionStats GetEditAdmissionStats() const { return EditStats; }
+
+    // Time per tick spent applying queued edits (at least one is applied per tick).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Edits", meta = (ClampMin = "0.1"))
+    float EditDrainBudgetMs = 2.f;
+
+    // Queued edits beyond this are rejected.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Edits", meta = (ClampMin = "1"))
+    int32 MaxQueuedEdits = 4096;
+
+    // Client visual: edits of unloaded chunks kept (with their sequence) for when they stream back in; the chunk
+    // unloaded longest ago goes first. Read at BeginPlay.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Net", meta = (ClampMin = "0"))
+    int32 MaxCachedChunkEdits = 1024;
+
+    // Server: ops kept per chunk for catching up clients without a reset.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Net", meta = (ClampMin = "1"))
+    int32 MaxDeltaLogOps = 256;
+
     UFUNCTION(BlueprintCallable, Category = "Voxel|Net")
     void ApplyVisualOpOrQueue(FIntPoint ChunkXZ, int32 LocalIndex, int32 NewBlockId);
 
-    void HandleNetStateDestroyed(class AVoxelChunkNetState* State);
-
     TSet<FChunkKey> SnapshotRequestedOnce;
 
     // Hard cap on how many new chunk builds we may enqueue this Tick, regardless of available slots.
@@ -173,6 +315,45 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Perf", meta = (ClampMin = "1"))
     int32 DrainMaxItemsPerTick = 6;
 
+    // Render chunks through UVoxelChunkComponent with 8-byte packed vertices instead of procedural mesh sections.
+    // Collision is unchanged: chunks in the collision radius still build greedy FProcMeshSection collision sections.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Perf")
+    bool bUsePackedChunkRendering = false;
+
+    // Distance LOD: chunks past RenderRadiusChunks get a downsampled, render-only mesh (client/listen only).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|LOD")
+    bool bEnableLOD = true;
+
+    // Outer radius (in chunks, square rings like RenderRadiusChunks) of LOD 1 (2x), 2 (4x) and 3 (8x).
+    // Each ring starts where the previous one ends; the first starts past RenderRadiusChunks.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|LOD")
+    TArray<int32> LODRingRadiiChunks = { 12, 18, 24 };
+
+    // Heightmap horizon past the voxel/LOD chunks, straight from the generator (client/listen only).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Horizon")
+    bool bEnableFarTerrain = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Horizon", meta = (ClampMin = "0"))
+    int32 FarTerrainRadiusChunks = 96;
+
+    // Far terrain tiles uploaded per Tick (each upload refreshes the horizon mesh component).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Horizon", meta = (ClampMin = "1"))
+    int32 FarTerrainUploadsPerTick = 2;
+
+    // Keep chunk data only: no render or collision meshes are built. For headless servers whose pawns move with
+    // UVoxelCharacterMovementComponent and whose edits are validated with VoxelRaycast.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Collision")
+    bool bSkipChunkMeshing = false;
+
+    // Chunks within this many chunks (square, like RenderRadiusChunks) of any pawn or tracked actor get collision.
+    // Negative = every loaded chunk.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Collision", meta = (ClampMin = "-1"))
+    int32 CollisionRadiusChunks = 2;
+
+    // Border faces toward unloaded neighbors. Either way the chunk is remeshed once the neighbor loads.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Perf")
+    EVoxelMissingNeighborPolicy MissingNeighborPolicy = EVoxelMissingNeighborPolicy::EmitFaces;
+
     static FORCEINLINE bool LocalIndexToXYZ(int32 LI, int32& X, int32& Y, int32& Z)
     {
         if (LI < 0 || LI >= CHUNK_VOLUME) return false;
@@ -212,15 +393,155 @@ private:
 
     bool EnsureChunkDataLoaded_ForEdit(const FChunkKey& Key, FChunkRecord*& OutRec);
 
-    // Server-only: replicated net state actors per chunk (no UPROPERTY  FChunkKey is not a USTRUCT)
-    TMap<FChunkKey, TWeakObjectPtr<AVoxelChunkNetState>> ChunkNetStates;
+    // Server: per-chunk edit log. Sequences survive the chunk unloading (only the recent ops are dropped).
+    struct FChunkDeltaLog
+    {
+        int32 BaseSeq = 0;               // sequence before Recent[0]
+        int32 HeadSeq = 0;               // latest edit
+        TArray<FVoxelCellOp> Recent;     // ops BaseSeq+1 .. HeadSeq
+    };
+    TMap<FChunkKey, FChunkDeltaLog> DeltaLogs;
+
+    // A new log starts past 0 if the chunk already has modified cells (from disk), so fresh clients get a reset.
+    FChunkDeltaLog& GetDeltaLog_Server(const FChunkKey& Key, const FVoxelChunkData& Data);
 
-    // Server-only helpers
-    AVoxelChunkNetState* GetOrCreateNetState_Server(const FChunkKey& Key);
-    void DestroyNetState_Server(const FChunkKey& Key);
+    // Client visual: last applied sequence per chunk (queued ops included)
+    TMap<FChunkKey, int32> ClientDeltaSeq;
 
-    void KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkData> Existing);
+    // Client visual: chunks loading when a reset arrived; their generated/cached deltas are dropped on drain
+    TSet<FChunkKey> PendingNetResets;
+
+    // Client visual: cells showing a predicted value, with the newest prediction and the server's value under it
+    struct FPredictedCell
+    {
+        int32 PredictionId = 0;
+        uint8 ConfirmedId = 0;
+    };
+    TMap<FChunkKey, TMap<int32, FPredictedCell>> PredictedCells;
+
+    // Client visual: predictions waiting for the server's answer (ConfirmSeq 0) or for the delta carrying it
+    struct FPendingPrediction
+    {
+        FChunkKey Key;
+        int32 LocalIndex = 0;
+        int32 ConfirmSeq = 0;
+    };
+    TMap<int32, FPendingPrediction> PendingPredictions;
+
+    // Forget one prediction; if it still owns its cell, the cell shows the server's value again
+    void SettlePrediction_Client(int32 PredictionId);
+
+    // Chunk leaving: put the server's values back into its data (no rebuild) and forget its predictions
+    void DropPredictionsForChunk_Client(const FChunkKey& Key, FVoxelChunkData& Data);
+
+    struct FCachedChunkEdits
+    {
+        int32 Seq = 0;
+        TMap<int32, uint16> ModifiedBlocks;
+    };
+    TLruCache<FChunkKey, FCachedChunkEdits> ClientEditCache;
+
+    // Client visual: streamed contents by content hash, and the hash each chunk was last given
+    TLruCache<uint32, TSharedPtr<const TArray<uint8>>> ContentCache;
+    TMap<FChunkKey, uint32> ChunkContentHashes;
+    // Client visual: chunks whose hash the server confirmed this session, and when the unanswered ones were asked for
+    TSet<FChunkKey> ConfirmedContents;
+    TMap<FChunkKey, double> RequestedContents;
+    TArray<FVoxelChunkContentRequest> OutgoingContentRequests;
+
+    // Client visual: Key's confirmed contents, or null after queueing a request for them (again only if the
+    // server dropped it: unanswered after ContentRequestTimeoutSeconds)
+    static constexpr double ContentRequestTimeoutSeconds = 10.0;
+    TSharedPtr<const TArray<uint8>> FindStreamedContent_Client(const FChunkKey& Key);
+    void FlushContentRequests_Client();
+
+    // Server: encoded contents by chunk, and the chunks being encoded off-thread
+    struct FServedChunkContent
+    {
+        uint32 Hash = 0;
+        TSharedPtr<const TArray<uint8>> Payload;
+    };
+    TLruCache<FChunkKey, FServedChunkContent> ServedContents;
+    TSet<FChunkKey> ContentEncodesInFlight;
+    TQueue<TPair<FChunkKey, FServedChunkContent>, EQueueMode::Mpsc> CompletedContentEncodes;
+
+    // Rebuilds owed by the open edit batch, per edited chunk
+    struct FDeferredEditRemesh
+    {
+        uint32 Sections = 0;
+        uint8 BorderSides = 0;
+    };
+    int32 EditBatchDepth = 0;
+    TMap<FChunkKey, FDeferredEditRemesh> DeferredEditRemesh;
+
+    // Server: admitted edits in arrival order; EditQueue[EditQueueHead] is next
+    struct FQueuedEdit
+    {
+        TWeakObjectPtr<AVoxelPlayerController> Requester;
+        FBlockEditRequest Req;
+    };
+    TArray<FQueuedEdit> EditQueue;
+    int32 EditQueueHead = 0;
+    FVoxelEditAdmissionStats EditStats;
+
+    void DrainEditQueue_Server();
+
+    // Mesh SectionMask (vertical slabs) of the chunk off-thread. A chunk without an actor is always built whole.
+    // While a build for Key is in flight, the sections are recorded on the record and rebuilt on drain.
+    void KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkData> Existing, uint32 SectionMask = CHUNK_ALL_SECTIONS);
+
+    // KickBuild for a loaded chunk (no-op if its data is gone).
+    void RequestRemesh(const FChunkKey& Key, uint32 SectionMask = CHUNK_ALL_SECTIONS);
+
+    // Neighbor-aware meshing: remesh this chunk / its neighbors if either was meshed without the other.
+    void RefreshNeighborBorders(const FChunkKey& Key, bool bNewlyLoaded);
+
+    // Remesh loaded neighbors on the given FVoxelChunkBorders sides (border edits).
+    void RemeshNeighbors(const FChunkKey& Key, uint8 SideMask, uint32 SectionMask, TArray<FChunkKey>* OutRebuilt = nullptr);
+    static uint8 BorderSidesForCell(int32 LX, int32 LZ);
     void SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMeshResult>& Res);
+
+    // Snapshot of the neighbor layers around Key (game thread), for the mesher.
+    void CaptureBorders(const FChunkKey& Key, FVoxelChunkBorders& OutBorders) const;
+
+    // ---- Collision radius ----
+    // Chunk positions of every pawn and tracked actor, refreshed at the update cadence.
+    TArray<FIntPoint> CollisionCenters;
+
+    void UpdateCollisionCenters(const TArray<FIntPoint>& Centers);
+    // Pad widens the radius (hysteresis when dropping collision).
+    bool WantsCollision(const FChunkKey& Key, int32 Pad = 0) const;
+    // Collision-only build for a loaded chunk that has none yet.
+    void KickCollisionBuild(const FChunkKey& Key);
+    void ApplyCollisionResult(const TSharedPtr<FChunkMeshResult>& Res);
+    // Add or drop collision as pawns move; collision builds spend the enqueue budget.
+    void UpdateCollisionRadius(int32& InOutEnqueueBudget);
+
+    // ---- Far LOD chunks ----
+    TMap<FChunkKey, FLODChunkRecord> LODLoaded;
+    TSet<FChunkKey> LODPending;
+
+    // MaxConcurrentBackgroundTasks less everything in flight: chunk and LOD builds and content encodes
+    int32 GetFreeBackgroundSlots() const
+    {
+        return FMath::Max(0, MaxConcurrentBackgroundTasks - Pending.Num() - LODPending.Num() - ContentEncodesInFlight.Num());
+    }
+
+    bool IsLODActive() const;
+    // LOD level for a ring distance (Chebyshev, in chunks); 0 = full resolution or out of range.
+    int32 GetLODForDistance(int32 Distance) const;
+    void KickLODBuild(const FChunkKey& Key, int32 LOD);
+    void SpawnOrUpdateLODChunkFromResult(const TSharedPtr<FChunkMeshResult>& Res);
+    // Streaming step for the LOD rings: retire/queue LOD chunks and spend what is left of the enqueue budget.
+    void UpdateLODRings(const TArray<FIntPoint>& Centers, int32& InOutEnqueueBudget);
+    // Show or hide the far mesh for Key (hidden while the full-resolution chunk is on screen).
+    void SetLODChunkHidden(const FChunkKey& Key, bool bHidden);
+
+    // ---- Heightmap horizon ----
+    UPROPERTY(Transient)
+    AVoxelFarTerrainActor* FarTerrain = nullptr;
+
+    void UpdateFarTerrain(const TArray<FIntPoint>& Centers);
     void UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired);
     void FlushAllDirtyChunks();
 
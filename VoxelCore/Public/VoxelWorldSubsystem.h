@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/World.h"
+#include "VoxelWorldSubsystem.generated.h"
+
+class AVoxelWorldManager;
+
+/**
+ * Per-world registry of voxel world managers, so lookups never scan the level.
+ * Managers register in BeginPlay / unregister in EndPlay. There are only ever a handful (server,
+ * client visual), so the role filters below walk a tiny list instead of every actor in the level.
+ */
+UCLASS()
+class VOXELCORE_API UVoxelWorldSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+public:
+    static UVoxelWorldSubsystem* Get(const UWorld* World)
+    {
+        return World ? World->GetSubsystem<UVoxelWorldSubsystem>() : nullptr;
+    }
+
+    void RegisterManager(AVoxelWorldManager* Manager);
+    void UnregisterManager(AVoxelWorldManager* Manager);
+
+    // Server / standalone: the manager holding the authoritative data.
+    AVoxelWorldManager* GetAuthoritativeManager() const;
+
+    // The client-visual manager (also on a listen server).
+    AVoxelWorldManager* GetClientVisualManager() const;
+
+    // Local data to query: the client-visual manager if there is one, else any manager (standalone).
+    AVoxelWorldManager* GetLocalManager() const;
+
+private:
+    TArray<TWeakObjectPtr<AVoxelWorldManager>> Managers;
+};
@@ -10,12 +10,15 @@ public class VoxelCore : ModuleRules
 
         PublicIncludePaths.AddRange(new string[] {Path.Combine(ModuleDirectory, "Public")});
 
+        // Engine-independent kernels: compiled with the module, also built standalone by VoxelKernel/CMakeLists.txt.
+        PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Kernel", "Public"));
+
         PrivateIncludePaths.AddRange(
         new string[] {Path.Combine(ModuleDirectory, "Private"),Path.Combine(ModuleDirectory, "ThirdParty", "FastNoiseLite", "include")});
 
         PublicDependencyModuleNames.AddRange(new string[]{"Core", "CoreUObject", "Engine", "InputCore"});
 
-        PrivateDependencyModuleNames.AddRange(new string[] { });
+        PrivateDependencyModuleNames.AddRange(new string[] { "RenderCore", "RHI" });
 
         PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "ProceduralMeshComponent" });
 
@@ -0,0 +1,253 @@
+#include "VoxelKernel/ChunkMesher.h"
+#include "VoxelKernel/RunCodec.h"
+#include "VoxelKernel/TerrainGenerator.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+// Kernel microbenchmarks. Items are chunks unless a benchmark says otherwise, so items_per_second reads as chunks/s and
+// compares directly with the Voxel.Bench.* automation tests that run the same kernels inside the engine.
+
+using namespace VoxelKernel;
+
+namespace
+{
+    constexpr int32_t Seed = 1337;
+    constexpr int32_t NumChunks = 64;
+
+    struct FChunkData
+    {
+        std::vector<uint8_t> Blocks = std::vector<uint8_t>(CHUNK_VOLUME);
+        FChunkExtents Extents;
+
+        FChunkView View() const
+        {
+            FChunkView Result;
+            Result.Blocks = Blocks.data();
+            Result.Extents = &Extents;
+            return Result;
+        }
+    };
+
+    // An 8x8 patch of generated terrain, built once and shared by every benchmark
+    const std::vector<FChunkData>& GetChunks()
+    {
+        static const std::vector<FChunkData> Chunks = []
+            {
+                const FTerrainGenerator Gen(Seed);
+                std::vector<FChunkData> Result(NumChunks);
+                for (int32_t i = 0; i < NumChunks; ++i)
+                {
+                    Gen.GenerateBaseChunk(i % 8, i / 8, Result[i].Blocks.data(), Result[i].Extents);
+                }
+                return Result;
+            }();
+        return Chunks;
+    }
+
+    // Packs the visible faces of one chunk the way the engine mesher fills its vertex buffer
+    void BuildPackedMesh(const FChunkView& View, int32_t Section, std::vector<FPackedVertex>& OutVertices)
+    {
+        ForEachVisibleCellFace(View, nullptr, Section, [&OutVertices](int32_t X, int32_t Y, int32_t Z, EFace Face, uint8_t Id)
+            {
+                const int32_t F = static_cast<int32_t>(Face);
+                for (int32_t c = 0; c < 4; ++c)
+                {
+                    OutVertices.push_back(FPackedVertex::Pack(X + FaceCorners[F][c][0], Y + FaceCorners[F][c][2], Z + FaceCorners[F][c][1], Face, c, Id, Id));
+                }
+            });
+    }
+}
+
+static void BM_GenerateBaseChunk(benchmark::State& State)
+{
+    const FTerrainGenerator Gen(Seed);
+    FChunkData Chunk;
+    int32_t i = 0;
+    for (auto _ : State)
+    {
+        Gen.GenerateBaseChunk(i % 8, i / 8, Chunk.Blocks.data(), Chunk.Extents);
+        benchmark::DoNotOptimize(Chunk.Blocks.data());
+        i = (i + 1) % NumChunks;
+    }
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_GenerateBaseChunk);
+
+static void BM_SampleColumnTopYGrid(benchmark::State& State)
+{
+    const FTerrainGenerator Gen(Seed);
+    std::vector<int32_t> Tops(CHUNK_COLUMNS);
+    for (auto _ : State)
+    {
+        Gen.SampleColumnTopYGrid(0, 0, 1, CHUNK_SIZE_X, CHUNK_SIZE_Z, Tops.data());
+        benchmark::DoNotOptimize(Tops.data());
+    }
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_SampleColumnTopYGrid);
+
+static void BM_ComputeExtents(benchmark::State& State)
+{
+    const std::vector<FChunkData>& Chunks = GetChunks();
+    FChunkExtents Extents;
+    int32_t i = 0;
+    for (auto _ : State)
+    {
+        ComputeExtents(Chunks[i].Blocks.data(), Extents);
+        benchmark::DoNotOptimize(&Extents);
+        i = (i + 1) % NumChunks;
+    }
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_ComputeExtents);
+
+static void BM_VisibleFaces(benchmark::State& State)
+{
+    const std::vector<FChunkData>& Chunks = GetChunks();
+    int64_t NumFaces = 0;
+    int32_t i = 0;
+    for (auto _ : State)
+    {
+        ForEachVisibleCellFace(Chunks[i].View(), nullptr, WHOLE_CHUNK, [&NumFaces](int32_t, int32_t, int32_t, EFace, uint8_t) { ++NumFaces; });
+        i = (i + 1) % NumChunks;
+    }
+    State.SetItemsProcessed(State.iterations());
+    State.counters["faces/chunk"] = benchmark::Counter(double(NumFaces) / double(State.iterations()));
+}
+BENCHMARK(BM_VisibleFaces);
+
+// Arg 0: whole chunk in one pass; 1: every section separately, as a full section remesh does
+static void BM_PackedMesh(benchmark::State& State)
+{
+    const std::vector<FChunkData>& Chunks = GetChunks();
+    const bool bPerSection = State.range(0) != 0;
+    std::vector<FPackedVertex> Vertices;
+    int64_t NumVertices = 0;
+    int32_t i = 0;
+    for (auto _ : State)
+    {
+        Vertices.clear();
+        if (bPerSection)
+        {
+            for (int32_t Section = 0; Section < CHUNK_NUM_SECTIONS; ++Section)
+            {
+                BuildPackedMesh(Chunks[i].View(), Section, Vertices);
+            }
+        }
+        else
+        {
+            BuildPackedMesh(Chunks[i].View(), WHOLE_CHUNK, Vertices);
+        }
+        benchmark::DoNotOptimize(Vertices.data());
+        NumVertices += static_cast<int64_t>(Vertices.size());
+        i = (i + 1) % NumChunks;
+    }
+    State.SetItemsProcessed(State.iterations());
+    State.SetBytesProcessed(NumVertices * int64_t(sizeof(FPackedVertex)));
+    State.counters["vertices/chunk"] = benchmark::Counter(double(NumVertices) / double(State.iterations()));
+}
+BENCHMARK(BM_PackedMesh)->Arg(0)->Arg(1);
+
+static void BM_CollisionRects(benchmark::State& State)
+{
+    const std::vector<FChunkData>& Chunks = GetChunks();
+    int64_t NumRects = 0;
+    int32_t i = 0;
+    for (auto _ : State)
+    {
+        ForEachCollisionRect(Chunks[i].View(), nullptr, WHOLE_CHUNK, [&NumRects](EFace, const int32_t (&)[3], const int32_t (&)[3]) { ++NumRects; });
+        i = (i + 1) % NumChunks;
+    }
+    State.SetItemsProcessed(State.iterations());
+    State.counters["rects/chunk"] = benchmark::Counter(double(NumRects) / double(State.iterations()));
+}
+BENCHMARK(BM_CollisionRects);
+
+static void BM_LODQuads(benchmark::State& State)
+{
+    const std::vector<FChunkData>& Chunks = GetChunks();
+    const int32_t LOD = static_cast<int32_t>(State.range(0));
+    int64_t NumQuads = 0;
+    int32_t i = 0;
+    for (auto _ : State)
+    {
+        ForEachLODQuad(Chunks[i].View(), LOD, [&NumQuads](const int32_t (&)[4][3], EFace, uint8_t) { ++NumQuads; });
+        i = (i + 1) % NumChunks;
+    }
+    State.SetItemsProcessed(State.iterations());
+    State.counters["quads/chunk"] = benchmark::Counter(double(NumQuads) / double(State.iterations()));
+}
+BENCHMARK(BM_LODQuads)->DenseRange(1, MAX_LOD);
+
+static void BM_WriteBlockRuns(benchmark::State& State)
+{
+    const std::vector<FChunkData>& Chunks = GetChunks();
+    std::vector<uint8_t> Body;
+    int64_t NumBytes = 0;
+    int32_t i = 0;
+    for (auto _ : State)
+    {
+        Body.clear();
+        WriteBlockRuns(Chunks[i].Blocks.data(), Body);
+        NumBytes += static_cast<int64_t>(Body.size());
+        i = (i + 1) % NumChunks;
+    }
+    State.SetItemsProcessed(State.iterations());
+    State.SetBytesProcessed(State.iterations() * int64_t(CHUNK_VOLUME));
+    State.counters["bytes/chunk"] = benchmark::Counter(double(NumBytes) / double(State.iterations()));
+}
+BENCHMARK(BM_WriteBlockRuns);
+
+static void BM_ReadBlockRuns(benchmark::State& State)
+{
+    const std::vector<FChunkData>& Chunks = GetChunks();
+    std::vector<std::vector<uint8_t>> Bodies(NumChunks);
+    for (int32_t c = 0; c < NumChunks; ++c)
+    {
+        WriteBlockRuns(Chunks[c].Blocks.data(), Bodies[c]);
+    }
+
+    std::vector<uint8_t> Blocks(CHUNK_VOLUME);
+    int32_t i = 0;
+    for (auto _ : State)
+    {
+        if (!ReadBlockRuns(Bodies[i].data(), Bodies[i].size(), Blocks.data()))
+        {
+            State.SkipWithError("ReadBlockRuns rejected its own output");
+            break;
+        }
+        benchmark::DoNotOptimize(Blocks.data());
+        i = (i + 1) % NumChunks;
+    }
+    State.SetItemsProcessed(State.iterations());
+    State.SetBytesProcessed(State.iterations() * int64_t(CHUNK_VOLUME));
+}
+BENCHMARK(BM_ReadBlockRuns);
+
+// Arg: edited cells per chunk, scattered at random (a player's dig/build history, not whole-chunk runs)
+static void BM_WriteCellRuns(benchmark::State& State)
+{
+    const int32_t NumEdits = static_cast<int32_t>(State.range(0));
+    std::mt19937 Rng(Seed);
+    std::vector<FCellValue> Edits(NumEdits);
+    for (FCellValue& Edit : Edits)
+    {
+        Edit.Index = static_cast<int32_t>(Rng() % CHUNK_VOLUME);
+        Edit.Id = static_cast<uint8_t>(Rng() % 4);
+    }
+
+    std::vector<FCellValue> Cells;
+    std::vector<uint8_t> Body;
+    for (auto _ : State)
+    {
+        // The writer sorts in place, so every pass starts again from the unsorted edits
+        Cells = Edits;
+        Body.clear();
+        WriteCellRuns(Cells.data(), NumEdits, Body);
+        benchmark::DoNotOptimize(Body.data());
+    }
+    State.SetItemsProcessed(State.iterations() * NumEdits);
+    State.counters["bytes"] = benchmark::Counter(double(Body.size()));
+}
+BENCHMARK(BM_WriteCellRuns)->RangeMultiplier(16)->Range(16, 4096);
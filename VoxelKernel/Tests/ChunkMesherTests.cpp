@@ -0,0 +1,221 @@
+#include "VoxelKernel/ChunkMesher.h"
+#include "VoxelKernel/TerrainGenerator.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace VoxelKernel;
+
+namespace
+{
+    // Dense chunk with extents kept in sync
+    struct FTestChunk
+    {
+        std::vector<uint8_t> Blocks = std::vector<uint8_t>(CHUNK_VOLUME, BlockId::Air);
+        FChunkExtents Extents;
+
+        void Set(int32_t X, int32_t Y, int32_t Z, uint8_t Id)
+        {
+            Blocks[IndexFromXYZ(X, Y, Z)] = Id;
+            ComputeExtents(Blocks.data(), Extents);
+        }
+
+        FChunkView View() const
+        {
+            FChunkView Result;
+            Result.Blocks = Blocks.data();
+            Result.Extents = &Extents;
+            return Result;
+        }
+    };
+
+    int32_t CountFaces(const FTestChunk& Chunk, const FBorderView* Borders = nullptr, int32_t Section = WHOLE_CHUNK, int32_t* OutPerFace = nullptr)
+    {
+        int32_t Num = 0;
+        ForEachVisibleCellFace(Chunk.View(), Borders, Section, [&](int32_t, int32_t, int32_t, EFace Face, uint8_t)
+            {
+                if (OutPerFace) ++OutPerFace[static_cast<int32_t>(Face)];
+                ++Num;
+            });
+        return Num;
+    }
+}
+
+TEST(ChunkMesher, SingleCube)
+{
+    FTestChunk Chunk;
+    Chunk.Set(5, 60, 7, BlockId::Stone);
+
+    int32_t PerFace[6] = {};
+    EXPECT_EQ(CountFaces(Chunk, nullptr, WHOLE_CHUNK, PerFace), 6);
+    for (int32_t F = 0; F < 6; ++F)
+    {
+        EXPECT_EQ(PerFace[F], 1) << "face " << F;
+    }
+}
+
+TEST(ChunkMesher, SharedFacesCulled)
+{
+    FTestChunk Chunk;
+    Chunk.Set(5, 60, 7, BlockId::Stone);
+    Chunk.Set(6, 60, 7, BlockId::Dirt);
+    Chunk.Set(5, 61, 7, BlockId::Grass);
+
+    // 18 faces minus two per touching pair
+    EXPECT_EQ(CountFaces(Chunk), 14);
+}
+
+TEST(ChunkMesher, EmptyChunkEmitsNothing)
+{
+    FTestChunk Chunk;
+    FChunkView View = Chunk.View();
+    View.Blocks = nullptr; // never read
+    int32_t Num = 0;
+    ForEachVisibleCellFace(View, nullptr, WHOLE_CHUNK, [&](int32_t, int32_t, int32_t, EFace, uint8_t) { ++Num; });
+    ForEachLODQuad(View, 2, [&](const int32_t (&)[4][3], EFace, uint8_t) { ++Num; });
+    EXPECT_EQ(Num, 0);
+}
+
+TEST(ChunkMesher, BorderSlabs)
+{
+    FTestChunk Chunk;
+    Chunk.Set(CHUNK_SIZE_X - 1, 10, 4, BlockId::Stone);
+
+    // No borders: the chunk side counts as air
+    int32_t PerFace[6] = {};
+    CountFaces(Chunk, nullptr, WHOLE_CHUNK, PerFace);
+    EXPECT_EQ(PerFace[static_cast<int32_t>(EFace::PosX)], 1);
+
+    // A solid neighbor cell across +X culls the face
+    std::vector<uint8_t> Slab(CHUNK_SIZE_Z * CHUNK_SIZE_Y, BlockId::Air);
+    Slab[4 + 10 * CHUNK_SIZE_Z] = BlockId::Stone;
+    FBorderView Borders;
+    Borders.Slabs[FBorderView::PosX] = Slab.data();
+    int32_t WithSlab[6] = {};
+    CountFaces(Chunk, &Borders, WHOLE_CHUNK, WithSlab);
+    EXPECT_EQ(WithSlab[static_cast<int32_t>(EFace::PosX)], 0);
+
+    // Missing sides assumed solid cull as well
+    FBorderView Solid;
+    Solid.bMissingIsSolid = true;
+    int32_t Assumed[6] = {};
+    CountFaces(Chunk, &Solid, WHOLE_CHUNK, Assumed);
+    EXPECT_EQ(Assumed[static_cast<int32_t>(EFace::PosX)], 0);
+    EXPECT_EQ(Assumed[static_cast<int32_t>(EFace::NegX)], 1);
+}
+
+TEST(ChunkMesher, Sections)
+{
+    FTestChunk Chunk;
+    Chunk.Set(1, CHUNK_SECTION_SIZE_Y + 3, 1, BlockId::Stone);
+
+    EXPECT_EQ(CountFaces(Chunk, nullptr, 0), 0);
+    EXPECT_EQ(CountFaces(Chunk, nullptr, 1), 6);
+    EXPECT_EQ(CountFaces(Chunk, nullptr, 2), 0);
+}
+
+TEST(ChunkMesher, SectionMask)
+{
+    EXPECT_EQ(GetSectionMaskForCellY(-1), 0u);
+    EXPECT_EQ(GetSectionMaskForCellY(CHUNK_SIZE_Y), 0u);
+    EXPECT_EQ(GetSectionMaskForCellY(0), 1u);
+    EXPECT_EQ(GetSectionMaskForCellY(5), 1u);
+    EXPECT_EQ(GetSectionMaskForCellY(CHUNK_SECTION_SIZE_Y - 1), 3u);
+    EXPECT_EQ(GetSectionMaskForCellY(CHUNK_SECTION_SIZE_Y), 3u);
+    EXPECT_EQ(GetSectionMaskForCellY(CHUNK_SIZE_Y - 1), 1u << (CHUNK_NUM_SECTIONS - 1));
+}
+
+TEST(ChunkMesher, CollisionMergesFlatLayer)
+{
+    FTestChunk Chunk;
+    for (int32_t Z = 0; Z < CHUNK_SIZE_Z; ++Z)
+    {
+        for (int32_t X = 0; X < CHUNK_SIZE_X; ++X)
+        {
+            Chunk.Blocks[IndexFromXYZ(X, 0, Z)] = BlockId::Stone;
+        }
+    }
+    ComputeExtents(Chunk.Blocks.data(), Chunk.Extents);
+
+    // One rectangle per face direction, each spanning the whole layer side
+    int32_t PerFace[6] = {};
+    ForEachCollisionRect(Chunk.View(), nullptr, WHOLE_CHUNK, [&](EFace Face, const int32_t (&Lo)[3], const int32_t (&Hi)[3])
+        {
+            ++PerFace[static_cast<int32_t>(Face)];
+            EXPECT_EQ(Lo[1], 0);
+            EXPECT_EQ(Hi[1], 1);
+            const int32_t Area = (Hi[0] - Lo[0]) * (Hi[1] - Lo[1]) * (Hi[2] - Lo[2]);
+            EXPECT_EQ(Area, (Face == EFace::PosZ || Face == EFace::NegZ) ? CHUNK_COLUMNS : CHUNK_SIZE_X);
+        });
+    for (int32_t F = 0; F < 6; ++F)
+    {
+        EXPECT_EQ(PerFace[F], 1) << "face " << F;
+    }
+}
+
+// Merged rectangles cover exactly the visible faces of generated terrain
+TEST(ChunkMesher, CollisionCoversVisibleFaces)
+{
+    FTestChunk Chunk;
+    FTerrainGenerator(1337).GenerateBaseChunk(3, -7, Chunk.Blocks.data(), Chunk.Extents);
+
+    for (int32_t Section = WHOLE_CHUNK; Section < CHUNK_NUM_SECTIONS; ++Section)
+    {
+        int64_t Covered = 0;
+        ForEachCollisionRect(Chunk.View(), nullptr, Section, [&](EFace, const int32_t (&Lo)[3], const int32_t (&Hi)[3])
+            {
+                Covered += int64_t(Hi[0] - Lo[0]) * (Hi[1] - Lo[1]) * (Hi[2] - Lo[2]);
+            });
+        EXPECT_EQ(Covered, CountFaces(Chunk, nullptr, Section)) << "section " << Section;
+    }
+}
+
+TEST(ChunkMesher, LODFlatTerrain)
+{
+    FTestChunk Chunk;
+    for (int32_t Z = 0; Z < CHUNK_SIZE_Z; ++Z)
+    {
+        for (int32_t X = 0; X < CHUNK_SIZE_X; ++X)
+        {
+            for (int32_t Y = 0; Y <= 20; ++Y)
+            {
+                Chunk.Blocks[IndexFromXYZ(X, Y, Z)] = (Y == 20) ? BlockId::Grass : BlockId::Stone;
+            }
+        }
+    }
+    ComputeExtents(Chunk.Blocks.data(), Chunk.Extents);
+
+    for (int32_t LOD = 1; LOD <= MAX_LOD; ++LOD)
+    {
+        const int32_t Coarse = CHUNK_SIZE_X >> LOD;
+        int32_t Tops = 0, Skirts = 0;
+        ForEachLODQuad(Chunk.View(), LOD, [&](const int32_t (&Corners)[4][3], EFace Face, uint8_t Id)
+            {
+                EXPECT_EQ(Id, BlockId::Grass);
+                if (Face == EFace::PosZ)
+                {
+                    ++Tops;
+                    EXPECT_EQ(Corners[0][1], 21);
+                }
+                else
+                {
+                    ++Skirts;
+                }
+            });
+
+        // Flat: no steps inside the chunk, only edge skirts
+        EXPECT_EQ(Tops, Coarse * Coarse) << "LOD " << LOD;
+        EXPECT_EQ(Skirts, 4 * Coarse) << "LOD " << LOD;
+    }
+}
+
+TEST(ChunkMesher, PackedVertexRoundTrip)
+{
+    const FPackedVertex V = FPackedVertex::Pack(16, 128, 9, EFace::NegY, 3, 14, 200);
+    EXPECT_EQ(V.GetX(), 16);
+    EXPECT_EQ(V.GetY(), 128);
+    EXPECT_EQ(V.GetZ(), 9);
+    EXPECT_EQ(V.GetFace(), EFace::NegY);
+    EXPECT_EQ(V.GetCorner(), 3);
+    EXPECT_EQ(V.GetTile(), 14);
+    EXPECT_EQ(V.GetColorIndex(), 200);
+}
@@ -0,0 +1,99 @@
+#include "VoxelKernel/ChunkStorage.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace VoxelKernel;
+
+TEST(ChunkLayout, IndexStrides)
+{
+    // X fastest, then Z, then Y (one horizontal layer after another)
+    EXPECT_EQ(IndexFromXYZ(1, 0, 0), 1);
+    EXPECT_EQ(IndexFromXYZ(0, 0, 1), CHUNK_SIZE_X);
+    EXPECT_EQ(IndexFromXYZ(0, 1, 0), CHUNK_SIZE_X * CHUNK_SIZE_Z);
+    EXPECT_EQ(IndexFromXYZ(CHUNK_SIZE_X - 1, CHUNK_SIZE_Y - 1, CHUNK_SIZE_Z - 1), CHUNK_VOLUME - 1);
+}
+
+TEST(ChunkLayout, IndexRoundTrip)
+{
+    for (int32_t Index = 0; Index < CHUNK_VOLUME; ++Index)
+    {
+        int32_t X = 0, Y = 0, Z = 0;
+        XYZFromIndex(Index, X, Y, Z);
+        ASSERT_EQ(IndexFromXYZ(X, Y, Z), Index);
+        ASSERT_EQ(ColumnIndex(X, Z), Index % CHUNK_COLUMNS);
+    }
+}
+
+TEST(ChunkExtents, EmptyChunk)
+{
+    std::vector<uint8_t> Blocks(CHUNK_VOLUME, BlockId::Air);
+    FChunkExtents Extents;
+    ComputeExtents(Blocks.data(), Extents);
+
+    EXPECT_TRUE(Extents.IsEmpty());
+    for (int32_t C = 0; C < CHUNK_COLUMNS; ++C)
+    {
+        EXPECT_TRUE(Extents.IsColumnEmpty(C));
+        EXPECT_EQ(Extents.GetColumnTopY(C), -1);
+    }
+}
+
+TEST(ChunkExtents, ComputeFromBlocks)
+{
+    std::vector<uint8_t> Blocks(CHUNK_VOLUME, BlockId::Air);
+    Blocks[IndexFromXYZ(3, 10, 4)] = BlockId::Stone;
+    Blocks[IndexFromXYZ(3, 40, 4)] = BlockId::Dirt;
+    Blocks[IndexFromXYZ(7, 2, 9)] = BlockId::Grass;
+
+    FChunkExtents Extents;
+    ComputeExtents(Blocks.data(), Extents);
+
+    EXPECT_EQ(Extents.ColumnMinY[ColumnIndex(3, 4)], 10);
+    EXPECT_EQ(Extents.ColumnMaxY[ColumnIndex(3, 4)], 40);
+    EXPECT_EQ(Extents.GetColumnTopY(ColumnIndex(7, 9)), 2);
+    EXPECT_TRUE(Extents.IsColumnEmpty(ColumnIndex(0, 0)));
+    EXPECT_EQ(Extents.MinNonAirY, 2);
+    EXPECT_EQ(Extents.MaxNonAirY, 40);
+}
+
+// Incremental updates (Grow on add, RescanColumn + FoldColumns on remove) must agree with a full rebuild
+TEST(ChunkExtents, IncrementalMatchesRebuild)
+{
+    std::vector<uint8_t> Blocks(CHUNK_VOLUME, BlockId::Air);
+    FChunkExtents Extents;
+    std::mt19937 Rng(42);
+
+    for (int32_t Step = 0; Step < 4000; ++Step)
+    {
+        const int32_t Index = static_cast<int32_t>(Rng() % CHUNK_VOLUME);
+        const uint8_t Id = (Rng() % 3 == 0) ? BlockId::Air : BlockId::Stone;
+        int32_t X = 0, Y = 0, Z = 0;
+        XYZFromIndex(Index, X, Y, Z);
+        Blocks[Index] = Id;
+
+        const int32_t C = ColumnIndex(X, Z);
+        if (Id != BlockId::Air)
+        {
+            Extents.Grow(X, Y, Z);
+        }
+        else if (Y == Extents.ColumnMinY[C] || Y == Extents.ColumnMaxY[C])
+        {
+            Extents.RescanColumn(X, Z, [&](int32_t CellY) { return Blocks[IndexFromXYZ(X, CellY, Z)] != BlockId::Air; });
+            Extents.FoldColumns();
+        }
+    }
+
+    FChunkExtents Rebuilt;
+    ComputeExtents(Blocks.data(), Rebuilt);
+    for (int32_t C = 0; C < CHUNK_COLUMNS; ++C)
+    {
+        ASSERT_EQ(Extents.GetColumnTopY(C), Rebuilt.GetColumnTopY(C)) << "column " << C;
+        if (!Rebuilt.IsColumnEmpty(C))
+        {
+            ASSERT_EQ(Extents.ColumnMinY[C], Rebuilt.ColumnMinY[C]) << "column " << C;
+        }
+    }
+    EXPECT_EQ(Extents.MinNonAirY, Rebuilt.MinNonAirY);
+    EXPECT_EQ(Extents.MaxNonAirY, Rebuilt.MaxNonAirY);
+}
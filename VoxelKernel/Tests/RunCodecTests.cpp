@@ -0,0 +1,139 @@
+#include "VoxelKernel/RunCodec.h"
+#include "VoxelKernel/TerrainGenerator.h"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace VoxelKernel;
+
+// Byte layouts FBitWriter produces for the same calls; payloads must stay readable by older builds
+TEST(BitStream, MatchesEngineLayout)
+{
+    {
+        FBitStreamWriter Writer;
+        Writer.WriteIntPacked(0);
+        Writer.WriteIntPacked(1);
+        Writer.WriteIntPacked(128);
+        EXPECT_EQ(Writer.GetBuffer(), (std::vector<uint8_t>{ 0x00, 0x02, 0x01, 0x02 }));
+    }
+    {
+        // Bounded ints stop early: 2 of 3 takes two bits, 0 of 3 two bits, 4 of 5 three bits
+        FBitStreamWriter Writer;
+        Writer.WriteInt(2, 3);
+        Writer.WriteInt(0, 3);
+        Writer.WriteInt(4, 5);
+        EXPECT_EQ(Writer.GetBuffer(), (std::vector<uint8_t>{ 0x42 }));
+    }
+    {
+        // Bytes straddle byte boundaries lowest bit first
+        FBitStreamWriter Writer;
+        Writer.WriteBits(1, 1);
+        Writer.WriteByte(0xAB);
+        EXPECT_EQ(Writer.GetBuffer(), (std::vector<uint8_t>{ 0x57, 0x01 }));
+    }
+}
+
+TEST(BitStream, RoundTrip)
+{
+    std::mt19937 Rng(3);
+    std::vector<uint32_t> Values, Maxes;
+    FBitStreamWriter Writer;
+    for (int32_t i = 0; i < 2000; ++i)
+    {
+        const uint32_t Max = 2 + Rng() % 300;
+        const uint32_t Value = Rng() % Max;
+        Values.push_back(Value);
+        Maxes.push_back(Max);
+        Writer.WriteIntPacked(Value * 977u);
+        Writer.WriteInt(Value, Max);
+    }
+
+    FBitStreamReader Reader(Writer.GetBuffer().data(), Writer.GetBuffer().size());
+    for (size_t i = 0; i < Values.size(); ++i)
+    {
+        ASSERT_EQ(Reader.ReadIntPacked(), Values[i] * 977u);
+        ASSERT_EQ(Reader.ReadInt(Maxes[i]), Values[i]);
+    }
+    EXPECT_FALSE(Reader.IsError());
+
+    Reader.ReadBits(16);
+    EXPECT_TRUE(Reader.IsError());
+}
+
+TEST(RunCodec, CellsLastWins)
+{
+    std::mt19937 Rng(7);
+    std::vector<FCellValue> Cells;
+    std::map<int32_t, uint8_t> Expected;
+    for (int32_t i = 0; i < 3000; ++i)
+    {
+        FCellValue Cell;
+        Cell.Index = static_cast<int32_t>(Rng() % CHUNK_VOLUME);
+        Cell.Id = static_cast<uint8_t>(Rng() % 9);
+        Cells.push_back(Cell);
+        Expected[Cell.Index] = Cell.Id;
+    }
+    Cells.push_back({ -1, 4 });
+    Cells.push_back({ CHUNK_VOLUME, 4 });
+
+    std::vector<uint8_t> Body;
+    WriteCellRuns(Cells.data(), static_cast<int32_t>(Cells.size()), Body);
+
+    std::map<int32_t, uint8_t> Decoded;
+    ASSERT_TRUE(ReadRuns(Body.data(), Body.size(), [&](int32_t Start, int32_t End, uint8_t Id)
+        {
+            for (int32_t Index = Start; Index < End; ++Index) Decoded[Index] = Id;
+        }));
+    EXPECT_EQ(Decoded, Expected);
+}
+
+TEST(RunCodec, EmptyBody)
+{
+    std::vector<uint8_t> Body;
+    WriteCellRuns(nullptr, 0, Body);
+
+    int32_t Runs = 0;
+    EXPECT_TRUE(ReadRuns(Body.data(), Body.size(), [&](int32_t, int32_t, uint8_t) { ++Runs; }));
+    EXPECT_EQ(Runs, 0);
+}
+
+TEST(RunCodec, BlocksRoundTrip)
+{
+    std::vector<uint8_t> Blocks(CHUNK_VOLUME);
+    FChunkExtents Extents;
+    FTerrainGenerator(1337).GenerateBaseChunk(4, 4, Blocks.data(), Extents);
+
+    std::vector<uint8_t> Body;
+    WriteBlockRuns(Blocks.data(), Body);
+
+    // Layered terrain folds into a few hundred runs: far below one byte per cell
+    EXPECT_LT(Body.size(), size_t(CHUNK_VOLUME / 8));
+
+    std::vector<uint8_t> Decoded(CHUNK_VOLUME, 0xFF);
+    ASSERT_TRUE(ReadBlockRuns(Body.data(), Body.size(), Decoded.data()));
+    EXPECT_EQ(Decoded, Blocks);
+}
+
+TEST(RunCodec, MalformedBodies)
+{
+    std::vector<uint8_t> Blocks(CHUNK_VOLUME, BlockId::Stone);
+    Blocks[100] = BlockId::Air;
+    std::vector<uint8_t> Body;
+    WriteBlockRuns(Blocks.data(), Body);
+    std::vector<uint8_t> Out(CHUNK_VOLUME);
+
+    // Truncated
+    EXPECT_FALSE(ReadBlockRuns(Body.data(), Body.size() - 1, Out.data()));
+
+    // Runs that leave a hole are not a whole chunk
+    FCellValue Cells[2] = { { 0, BlockId::Stone }, { 10, BlockId::Stone } };
+    std::vector<uint8_t> Sparse;
+    WriteCellRuns(Cells, 2, Sparse);
+    EXPECT_FALSE(ReadBlockRuns(Sparse.data(), Sparse.size(), Out.data()));
+
+    // Palette larger than 256 entries
+    FBitStreamWriter Writer;
+    Writer.WriteIntPacked(300);
+    EXPECT_FALSE(ReadRuns(Writer.GetBuffer().data(), Writer.GetBuffer().size(), [](int32_t, int32_t, uint8_t) {}));
+}
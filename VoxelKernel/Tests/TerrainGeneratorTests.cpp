@@ -0,0 +1,81 @@
+#include "VoxelKernel/TerrainGenerator.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace VoxelKernel;
+
+static std::vector<uint8_t> Generate(const FTerrainGenerator& Gen, int32_t ChunkX, int32_t ChunkZ, FChunkExtents& OutExtents)
+{
+    std::vector<uint8_t> Blocks(CHUNK_VOLUME, 0xFF);
+    Gen.GenerateBaseChunk(ChunkX, ChunkZ, Blocks.data(), OutExtents);
+    return Blocks;
+}
+
+TEST(TerrainGenerator, Deterministic)
+{
+    FChunkExtents A, B, C;
+    const std::vector<uint8_t> First = Generate(FTerrainGenerator(1337), 5, -3, A);
+    const std::vector<uint8_t> Second = Generate(FTerrainGenerator(1337), 5, -3, B);
+    const std::vector<uint8_t> OtherSeed = Generate(FTerrainGenerator(7), 5, -3, C);
+
+    EXPECT_EQ(First, Second);
+    EXPECT_NE(First, OtherSeed);
+}
+
+TEST(TerrainGenerator, ColumnLayers)
+{
+    const FTerrainGenerator Gen(1337);
+    FChunkExtents Extents;
+    const int32_t ChunkX = -2, ChunkZ = 9;
+    const std::vector<uint8_t> Blocks = Generate(Gen, ChunkX, ChunkZ, Extents);
+
+    for (int32_t Z = 0; Z < CHUNK_SIZE_Z; ++Z)
+    {
+        for (int32_t X = 0; X < CHUNK_SIZE_X; ++X)
+        {
+            const int32_t Top = Gen.SampleColumnTopY(ChunkX * CHUNK_SIZE_X + X, ChunkZ * CHUNK_SIZE_Z + Z);
+            ASSERT_GE(Top, 1);
+            ASSERT_LT(Top, CHUNK_SIZE_Y);
+
+            // Grass on top, three layers of dirt, stone below, air above
+            for (int32_t Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+            {
+                const int32_t Depth = Top - Y;
+                const uint8_t Expected = Depth < 0 ? BlockId::Air : Depth == 0 ? BlockId::Grass : Depth <= 3 ? BlockId::Dirt : BlockId::Stone;
+                ASSERT_EQ(Blocks[IndexFromXYZ(X, Y, Z)], Expected) << X << "," << Y << "," << Z;
+            }
+        }
+    }
+}
+
+TEST(TerrainGenerator, ExtentsMatchBlocks)
+{
+    FChunkExtents Extents;
+    const std::vector<uint8_t> Blocks = Generate(FTerrainGenerator(99), 12, 4, Extents);
+
+    FChunkExtents Rebuilt;
+    ComputeExtents(Blocks.data(), Rebuilt);
+    for (int32_t C = 0; C < CHUNK_COLUMNS; ++C)
+    {
+        ASSERT_EQ(Extents.ColumnMinY[C], Rebuilt.ColumnMinY[C]);
+        ASSERT_EQ(Extents.ColumnMaxY[C], Rebuilt.ColumnMaxY[C]);
+    }
+    EXPECT_EQ(Extents.MinNonAirY, Rebuilt.MinNonAirY);
+    EXPECT_EQ(Extents.MaxNonAirY, Rebuilt.MaxNonAirY);
+}
+
+TEST(TerrainGenerator, GridMatchesColumns)
+{
+    const FTerrainGenerator Gen(1337);
+    const int32_t X0 = -40, Z0 = 17, Stride = 4, NumX = 9, NumZ = 7;
+    std::vector<int32_t> Tops(NumX * NumZ);
+    Gen.SampleColumnTopYGrid(X0, Z0, Stride, NumX, NumZ, Tops.data());
+
+    for (int32_t iz = 0; iz < NumZ; ++iz)
+    {
+        for (int32_t ix = 0; ix < NumX; ++ix)
+        {
+            EXPECT_EQ(Tops[ix + iz * NumX], Gen.SampleColumnTopY(X0 + ix * Stride, Z0 + iz * Stride));
+        }
+    }
+}